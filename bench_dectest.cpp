@@ -0,0 +1,294 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Throughput of the arithmetic operators over the operands of the decTest files.
+// The vectors are full of carries, rounding boundaries, subnormals and exponent gaps,
+// which makes them a more realistic load than uniformly random values.
+// Every file is loaded into contiguous arrays of each width and timed in a tight loop under several rounding modes,
+// then the IEEE layout types are timed against the decimal_fast*_t types,
+// and last the vectors of each file are split by the classes of their operands (see dectest_classes.hpp) and timed per class.
+// With BOOST_DECIMAL_DECTEST_BASELINE=FILE the first table is written to FILE for dectest_compare,
+// see dectest_baseline.hpp
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_bench.hpp"
+#include "dectest_baseline.hpp"
+
+#ifdef BOOST_DECIMAL_RUN_BENCHMARKS
+
+using namespace boost::decimal;
+
+template <typename T>
+struct operand_arrays
+{
+    std::vector<T> lhs;
+    std::vector<T> rhs;
+};
+
+// Operands that do not fit in T (e.g. too many digits for decimal32_t) still construct,
+// rounded by the library, only syntactically invalid ones are dropped
+template <typename T>
+operand_arrays<T> load_operands(const std::string& file, const std::string& op)
+{
+    operand_arrays<T> arrays;
+
+    const auto found {dectest::for_each_case(file, op, [&](const dectest::test_case& tc)
+    {
+        if (tc.flags != 0U || tc.operand_count != 2U)
+        {
+            return;
+        }
+
+        try
+        {
+            const auto lhs {dectest::make_decimal<T>(tc.operands[0])};
+            const auto rhs {dectest::make_decimal<T>(tc.operands[1])};
+            arrays.lhs.push_back(lhs);
+            arrays.rhs.push_back(rhs);
+        }
+        catch (const dectest::invalid_operand&)
+        {
+            // Conversion syntax tests
+        }
+    })};
+
+    BOOST_TEST(found);
+    return arrays;
+}
+
+// The rows of the first table, for the baseline
+dectest::bench::baseline& recorded()
+{
+    static dectest::bench::baseline b;
+    return b;
+}
+
+template <typename T, typename Function>
+void bench_op(const std::string& file, const std::string& op, const char* type, const dectest::rounding round, Function f)
+{
+    const auto arrays {load_operands<T>(file, op)};
+    const auto count {arrays.lhs.size()};
+
+    const auto entry_round {boost::decimal::fegetround()};
+    if (!set_dectest_rounding(round))
+    {
+        return;
+    }
+
+    const auto t {dectest::bench::time_repeated(dectest::bench::repeats_from_environment(), count, [&]()
+    {
+        for (std::size_t i {}; i < count; ++i)
+        {
+            dectest::bench::do_not_optimize(f(arrays.lhs[i], arrays.rhs[i]));
+        }
+    })};
+
+    boost::decimal::fesetround(entry_round);
+
+    BOOST_TEST_GT(count, 0U);
+
+    dectest::bench::baseline_entry e;
+    e.file = file;
+    e.op = op;
+    e.type = type;
+    e.rounding = dectest::rounding_name(round);
+    e.vectors = count;
+    e.ns_per_op = t.ns_per_op;
+    e.ns_mad = t.ns_mad;
+    e.cycles_per_op = t.cycles_per_op;
+    e.repeats = t.repeats;
+
+    std::cout << std::left << std::setw(36) << file << std::setw(12) << op << std::setw(14) << type << std::setw(12) << e.rounding
+              << std::right << std::setw(10) << count
+              << std::fixed << std::setprecision(2)
+              << std::setw(12) << t.ns_per_op << std::setw(10) << t.ns_mad << std::setw(12) << t.cycles_per_op
+              << std::defaultfloat << '\n';
+
+    recorded().entries.push_back(std::move(e));
+}
+
+// The modes the library has a setting for, see set_dectest_rounding
+template <typename Function>
+void bench_all_widths(const std::string& file, const std::string& op, Function f)
+{
+    for (const auto round : {dectest::rounding::half_even, dectest::rounding::half_up, dectest::rounding::floor, dectest::rounding::ceiling})
+    {
+        bench_op<decimal32_t>(file, op, "decimal32_t", round, f);
+        bench_op<decimal64_t>(file, op, "decimal64_t", round, f);
+        bench_op<decimal128_t>(file, op, "decimal128_t", round, f);
+    }
+}
+
+// The operands of file split by case_class, e.g. "normal x subnormal"
+template <typename T>
+std::vector<std::pair<std::string, operand_arrays<T>>> load_operands_by_class(const std::string& file, const std::string& op)
+{
+    std::vector<std::pair<std::string, operand_arrays<T>>> groups;
+
+    const auto found {dectest::for_each_case(file, op, [&](const dectest::test_case& tc)
+    {
+        if (tc.flags != 0U || tc.operand_count != 2U)
+        {
+            return;
+        }
+
+        try
+        {
+            const auto lhs {dectest::make_decimal<T>(tc.operands[0])};
+            const auto rhs {dectest::make_decimal<T>(tc.operands[1])};
+
+            auto label {dectest::case_class(tc)};
+            auto group {std::find_if(groups.begin(), groups.end(), [&](const std::pair<std::string, operand_arrays<T>>& g) { return g.first == label; })};
+            if (group == groups.end())
+            {
+                groups.emplace_back(std::move(label), operand_arrays<T>());
+                group = groups.end() - 1;
+            }
+
+            group->second.lhs.push_back(lhs);
+            group->second.rhs.push_back(rhs);
+        }
+        catch (const dectest::invalid_operand&)
+        {
+            // Conversion syntax tests
+        }
+    })};
+
+    BOOST_TEST(found);
+    return groups;
+}
+
+// Each class on its own in a tight loop, so the branch predictors learn its path as they would on a feed of such values
+template <typename T, typename Function>
+void bench_by_class(const std::string& file, const std::string& op, const char* type, Function f)
+{
+    for (const auto& group : load_operands_by_class<T>(file, op))
+    {
+        const auto& arrays {group.second};
+        const auto count {arrays.lhs.size()};
+
+        const auto t {dectest::bench::time_loop(count, [&]()
+        {
+            for (std::size_t i {}; i < count; ++i)
+            {
+                dectest::bench::do_not_optimize(f(arrays.lhs[i], arrays.rhs[i]));
+            }
+        }, std::chrono::milliseconds(20))};
+
+        std::cout << std::left << std::setw(36) << file << std::setw(12) << op << std::setw(14) << type << std::setw(32) << group.first
+                  << std::right << std::setw(10) << count
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(12) << t.ns_per_op << std::setw(12) << t.cycles_per_op
+                  << std::defaultfloat << '\n';
+    }
+}
+
+// Times the IEEE layout type and the matching fast type on the same vectors
+template <typename IEEE, typename Fast, typename Function>
+void bench_fast_vs_ieee(const std::string& file, const std::string& op, const char* type, Function f)
+{
+    const auto ieee {load_operands<IEEE>(file, op)};
+    const auto fast {load_operands<Fast>(file, op)};
+    const auto count {std::min(ieee.lhs.size(), fast.lhs.size())};
+
+    const auto ieee_time {dectest::bench::time_loop(count, [&]()
+    {
+        for (std::size_t i {}; i < count; ++i)
+        {
+            dectest::bench::do_not_optimize(f(ieee.lhs[i], ieee.rhs[i]));
+        }
+    })};
+
+    const auto fast_time {dectest::bench::time_loop(count, [&]()
+    {
+        for (std::size_t i {}; i < count; ++i)
+        {
+            dectest::bench::do_not_optimize(f(fast.lhs[i], fast.rhs[i]));
+        }
+    })};
+
+    BOOST_TEST_GT(count, 0U);
+
+    std::cout << std::left << std::setw(36) << file << std::setw(12) << op << std::setw(14) << type
+              << std::right << std::setw(10) << count
+              << std::fixed << std::setprecision(2)
+              << std::setw(12) << ieee_time.ns_per_op << std::setw(12) << fast_time.ns_per_op
+              << std::setw(10) << ieee_time.ns_per_op / fast_time.ns_per_op << 'x'
+              << std::defaultfloat << '\n';
+}
+
+template <typename Function>
+void bench_fast_all_widths(const std::string& file, const std::string& op, Function f)
+{
+    bench_fast_vs_ieee<decimal32_t, decimal_fast32_t>(file, op, "32", f);
+    bench_fast_vs_ieee<decimal64_t, decimal_fast64_t>(file, op, "64", f);
+    bench_fast_vs_ieee<decimal128_t, decimal_fast128_t>(file, op, "128", f);
+}
+
+int main()
+{
+    std::cout << std::left << std::setw(36) << "file" << std::setw(12) << "op" << std::setw(14) << "type" << std::setw(12) << "rounding"
+              << std::right << std::setw(10) << "vectors" << std::setw(12) << "ns/op" << std::setw(10) << "MAD"
+              << std::setw(12) << "cycles/op" << '\n';
+
+    const auto add = [](const auto x, const auto y) { return x + y; };
+    const auto mul = [](const auto x, const auto y) { return x * y; };
+    const auto div = [](const auto x, const auto y) { return x / y; };
+    const auto rem = [](const auto x, const auto y) { return x % y; };
+
+    bench_all_widths("dectest/ddAdd.decTest", "add", add);
+    bench_all_widths("dectest/dqAdd.decTest", "add", add);
+    bench_all_widths("dectest/ddMultiply.decTest", "multiply", mul);
+    bench_all_widths("dectest/dqMultiply.decTest", "multiply", mul);
+    bench_all_widths("dectest/ddDivide.decTest", "divide", div);
+    bench_all_widths("dectest/dqDivide.decTest", "divide", div);
+    bench_all_widths("dectest/ddRemainder.decTest", "remainder", rem);
+    bench_all_widths("dectest/dqRemainder.decTest", "remainder", rem);
+
+    // Same vectors again, decimalN_t against decimal_fastN_t.
+    // test_fast.cpp checks that the two agree
+    std::cout << '\n' << std::left << std::setw(36) << "file" << std::setw(12) << "op" << std::setw(14) << "width"
+              << std::right << std::setw(10) << "vectors" << std::setw(12) << "IEEE ns/op" << std::setw(12) << "fast ns/op"
+              << std::setw(11) << "speedup" << '\n';
+
+    bench_fast_all_widths("dectest/ddAdd.decTest", "add", add);
+    bench_fast_all_widths("dectest/dqAdd.decTest", "add", add);
+    bench_fast_all_widths("dectest/ddMultiply.decTest", "multiply", mul);
+    bench_fast_all_widths("dectest/dqMultiply.decTest", "multiply", mul);
+    bench_fast_all_widths("dectest/ddDivide.decTest", "divide", div);
+    bench_fast_all_widths("dectest/dqDivide.decTest", "divide", div);
+    bench_fast_all_widths("dectest/ddRemainder.decTest", "remainder", rem);
+    bench_fast_all_widths("dectest/dqRemainder.decTest", "remainder", rem);
+
+    std::cout << '\n' << std::left << std::setw(36) << "file" << std::setw(12) << "op" << std::setw(14) << "type" << std::setw(32) << "classes"
+              << std::right << std::setw(10) << "vectors" << std::setw(12) << "ns/op" << std::setw(12) << "cycles/op" << '\n';
+
+    bench_by_class<decimal64_t>("dectest/ddAdd.decTest", "add", "decimal64_t", add);
+    bench_by_class<decimal128_t>("dectest/dqAdd.decTest", "add", "decimal128_t", add);
+    bench_by_class<decimal64_t>("dectest/ddMultiply.decTest", "multiply", "decimal64_t", mul);
+    bench_by_class<decimal128_t>("dectest/dqMultiply.decTest", "multiply", "decimal128_t", mul);
+    bench_by_class<decimal64_t>("dectest/ddDivide.decTest", "divide", "decimal64_t", div);
+    bench_by_class<decimal128_t>("dectest/dqDivide.decTest", "divide", "decimal128_t", div);
+
+    const char* baseline_path {dectest::detail::environment("BOOST_DECIMAL_DECTEST_BASELINE")};
+    if (baseline_path != nullptr)
+    {
+        recorded().metadata = dectest::bench::current_metadata();
+        BOOST_TEST(dectest::bench::write_baseline(baseline_path, recorded()));
+    }
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    std::cout << "Benchmarks not run" << std::endl;
+    return 0;
+}
+
+#endif
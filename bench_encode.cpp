@@ -0,0 +1,145 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Batch throughput of the DPD conversions, with the BID conversions for reference.
+// The values are those of dsEncode, ddEncode and dqEncode repeated to fill large arrays,
+// which exercises every declet pattern, the special values and both exponent forms.
+// test_encode.cpp checks the results
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_bench.hpp"
+#include "dectest_encode.hpp"
+
+#ifdef BOOST_DECIMAL_RUN_BENCHMARKS
+
+using namespace boost::decimal;
+
+constexpr std::size_t batch_size {std::size_t(1) << 16};
+
+// Every value of the file, decoded or parsed, repeated up to batch_size
+template <typename T>
+std::vector<T> load_values(const std::string& file)
+{
+    std::vector<T> values;
+
+    const auto add = [&](const dectest::string_view str)
+    {
+        dectest::encoded_operand bits {};
+        if (dectest::parse_encoded(str, bits))
+        {
+            if (bits.digits == sizeof(T) * 2U)
+            {
+                values.push_back(dectest::from_encoded<T>(bits));
+            }
+
+            return;
+        }
+
+        try
+        {
+            values.push_back(dectest::make_decimal<T>(str));
+        }
+        catch (const dectest::invalid_operand&)
+        {
+            // NaN payloads
+        }
+    };
+
+    const auto found {dectest::for_each_case(file, "apply", [&](const dectest::test_case& tc)
+    {
+        if (tc.operand_count == 1U)
+        {
+            add(tc.operands[0]);
+            add(tc.result);
+        }
+    })};
+
+    BOOST_TEST(found);
+    BOOST_TEST(!values.empty());
+
+    const auto distinct {values.size()};
+    for (std::size_t i {}; values.size() < batch_size && distinct > 0U; ++i)
+    {
+        values.push_back(values[i % distinct]);
+    }
+
+    return values;
+}
+
+template <typename T>
+void bench_width(const std::string& file, const char* type)
+{
+    using bits_type = decltype(to_dpd(T {}));
+
+    const auto values {load_values<T>(file)};
+    const auto count {values.size()};
+
+    std::vector<bits_type> dpd(count);
+    std::vector<bits_type> bid(count);
+    std::vector<T> decoded(count);
+
+    const auto encode_dpd {dectest::bench::time_loop(count, [&]()
+    {
+        for (std::size_t i {}; i < count; ++i)
+        {
+            dpd[i] = to_dpd(values[i]);
+        }
+        dectest::bench::do_not_optimize(dpd.data());
+    })};
+
+    const auto decode_dpd {dectest::bench::time_loop(count, [&]()
+    {
+        for (std::size_t i {}; i < count; ++i)
+        {
+            decoded[i] = from_dpd<T>(dpd[i]);
+        }
+        dectest::bench::do_not_optimize(decoded.data());
+    })};
+
+    const auto encode_bid {dectest::bench::time_loop(count, [&]()
+    {
+        for (std::size_t i {}; i < count; ++i)
+        {
+            bid[i] = to_bid(values[i]);
+        }
+        dectest::bench::do_not_optimize(bid.data());
+    })};
+
+    const auto decode_bid {dectest::bench::time_loop(count, [&]()
+    {
+        for (std::size_t i {}; i < count; ++i)
+        {
+            decoded[i] = from_bid<T>(bid[i]);
+        }
+        dectest::bench::do_not_optimize(decoded.data());
+    })};
+
+    dectest::bench::print_row(file, "to_dpd", type, count, encode_dpd);
+    dectest::bench::print_row(file, "from_dpd", type, count, decode_dpd);
+    dectest::bench::print_row(file, "to_bid", type, count, encode_bid);
+    dectest::bench::print_row(file, "from_bid", type, count, decode_bid);
+}
+
+int main()
+{
+    dectest::bench::print_header();
+
+    bench_width<decimal32_t>("archive/dectest/dsEncode.decTest", "decimal32_t");
+    bench_width<decimal64_t>("archive/dectest/ddEncode.decTest", "decimal64_t");
+    bench_width<decimal128_t>("archive/dectest/dqEncode.decTest", "decimal128_t");
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    std::cout << "Benchmarks not run" << std::endl;
+    return 0;
+}
+
+#endif
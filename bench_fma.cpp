@@ -0,0 +1,142 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// fma(x, y, z) against x * y + z on the operands of the fma files.
+// Both are timed on the same arrays as the median of repeated loops and checked against the result of the file,
+// to the exact ULP: x * y + z rounds twice, so it is the faster one only if it is also accurate enough.
+// Only the half_even cases whose result is a reference for the width are used (see result_rounded_to_width),
+// the library rounds half_even by default
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_bench.hpp"
+
+#ifdef BOOST_DECIMAL_RUN_BENCHMARKS
+
+using namespace boost::decimal;
+
+template <typename T>
+struct fma_arrays
+{
+    std::vector<T> x;
+    std::vector<T> y;
+    std::vector<T> z;
+    std::vector<T> expected;
+};
+
+template <typename T>
+fma_arrays<T> load_fma(const std::string& file)
+{
+    fma_arrays<T> arrays;
+    const auto width {dectest::detail::width_of(std::numeric_limits<T>::digits)};
+
+    const auto found {dectest::for_each_case(file, "fma", [&](const dectest::test_case& tc)
+    {
+        if (tc.flags != 0U || tc.operand_count != 3U || tc.ctx.round != dectest::rounding::half_even ||
+            !dectest::result_rounded_to_width(tc, width))
+        {
+            return;
+        }
+
+        try
+        {
+            const auto x {dectest::make_decimal<T>(tc.operands[0])};
+            const auto y {dectest::make_decimal<T>(tc.operands[1])};
+            const auto z {dectest::make_decimal<T>(tc.operands[2])};
+            const auto expected {dectest::make_decimal<T>(tc.result)};
+
+            // NaN results have no distance, test_fma checks them
+            if (!isnan(expected))
+            {
+                arrays.x.push_back(x);
+                arrays.y.push_back(y);
+                arrays.z.push_back(z);
+                arrays.expected.push_back(expected);
+            }
+        }
+        catch (const dectest::invalid_operand&)
+        {
+            // Conversion syntax tests
+        }
+    })};
+
+    BOOST_TEST(found);
+    return arrays;
+}
+
+template <typename T, typename Function>
+void time_and_check(const fma_arrays<T>& arrays, Function f, dectest::bench::timing& t, dectest::ulp_histogram& errors)
+{
+    const auto count {arrays.x.size()};
+    for (std::size_t i {}; i < count; ++i)
+    {
+        errors.record(ulp_distance(f(arrays.x[i], arrays.y[i], arrays.z[i]), arrays.expected[i]));
+    }
+
+    t = dectest::bench::time_repeated(dectest::bench::repeats_from_environment(), count, [&]()
+    {
+        for (std::size_t i {}; i < count; ++i)
+        {
+            dectest::bench::do_not_optimize(f(arrays.x[i], arrays.y[i], arrays.z[i]));
+        }
+    });
+}
+
+template <typename T>
+void bench_fma(const std::string& file, const char* type)
+{
+    const auto arrays {load_fma<T>(file)};
+    const auto count {arrays.x.size()};
+
+    dectest::bench::timing fused_time;
+    dectest::bench::timing separate_time;
+    dectest::ulp_histogram fused_errors;
+    dectest::ulp_histogram separate_errors;
+
+    time_and_check(arrays, [](const T x, const T y, const T z) { return fma(x, y, z); }, fused_time, fused_errors);
+    time_and_check(arrays, [](const T x, const T y, const T z) { return x * y + z; }, separate_time, separate_errors);
+
+    if (count == 0U)
+    {
+        std::cout << std::left << std::setw(36) << file << std::setw(14) << type << std::right << std::setw(10) << 0 << '\n';
+        return;
+    }
+
+    std::cout << std::left << std::setw(36) << file << std::setw(14) << type
+              << std::right << std::setw(10) << count
+              << std::fixed << std::setprecision(2)
+              << std::setw(12) << fused_time.ns_per_op << std::setw(12) << separate_time.ns_per_op
+              << std::setw(10) << separate_time.ns_per_op / fused_time.ns_per_op << 'x'
+              << std::setprecision(1)
+              << std::setw(11) << 100.0 * static_cast<double>(fused_errors.count(0U)) / static_cast<double>(count) << '%'
+              << std::setw(11) << 100.0 * static_cast<double>(separate_errors.count(0U)) / static_cast<double>(count) << '%'
+              << std::defaultfloat
+              << std::setw(14) << fused_errors.max() << std::setw(14) << separate_errors.max() << '\n';
+}
+
+int main()
+{
+    std::cout << std::left << std::setw(36) << "file" << std::setw(14) << "type"
+              << std::right << std::setw(10) << "vectors" << std::setw(12) << "fma ns/op" << std::setw(12) << "x*y+z ns/op"
+              << std::setw(11) << "speedup" << std::setw(12) << "fma exact" << std::setw(12) << "x*y+z exact"
+              << std::setw(14) << "fma max ULP" << std::setw(14) << "x*y+z max ULP" << '\n';
+
+    bench_fma<decimal32_t>("archive/dectest/fma.decTest", "decimal32_t");
+    bench_fma<decimal64_t>("archive/dectest/fma.decTest", "decimal64_t");
+    bench_fma<decimal64_t>("archive/dectest/ddFMA.decTest", "decimal64_t");
+    bench_fma<decimal128_t>("archive/dectest/dqFMA.decTest", "decimal128_t");
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    std::cout << "Benchmarks not run" << std::endl;
+    return 0;
+}
+
+#endif
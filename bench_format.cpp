@@ -0,0 +1,153 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Throughput of the decimal to string conversions over the toSci values of the base files.
+// Each value is written with to_chars in the three formats, snprintf and operator<<,
+// and the table gives ns/op and the output rate in MB/s. test_format.cpp checks the output
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_bench.hpp"
+#include <sstream>
+
+#ifdef BOOST_DECIMAL_RUN_BENCHMARKS
+
+using namespace boost::decimal;
+
+// Fixed notation of the largest decimal128_t has over 6000 digits
+constexpr std::size_t buffer_size {8192U};
+
+inline const char* printf_format_string(decimal32_t) noexcept { return "%.7Hg"; }
+inline const char* printf_format_string(decimal64_t) noexcept { return "%.16Dg"; }
+inline const char* printf_format_string(decimal128_t) noexcept { return "%.34DDg"; }
+
+// The toSci values of file whose precision selects T, as the harness would choose it
+template <typename T>
+std::vector<T> load_values(const std::string& file)
+{
+    std::vector<T> values;
+
+    const auto found {dectest::for_each_case(file, "toSci", [&](const dectest::test_case& tc)
+    {
+        const auto width {dectest::detail::width_of(tc.ctx.precision)};
+        if (tc.operand_count != 1U || tc.flags != 0U || width != dectest::detail::width_of(std::numeric_limits<T>::digits))
+        {
+            return;
+        }
+
+        try
+        {
+            values.push_back(dectest::make_decimal<T>(tc.result));
+        }
+        catch (const dectest::invalid_operand&)
+        {
+            // Conversion syntax tests
+        }
+    })};
+
+    BOOST_TEST(found);
+    return values;
+}
+
+// format(value, buffer) writes to buffer and returns the number of characters
+template <typename T, typename Function>
+void bench_format(const std::string& file, const char* name, const char* type, const std::vector<T>& values, Function format)
+{
+    static char buffer[buffer_size];
+
+    std::size_t bytes {};
+    for (const auto value : values)
+    {
+        bytes += format(value, buffer);
+    }
+
+    const auto t {dectest::bench::time_loop(values.size(), [&]()
+    {
+        for (const auto value : values)
+        {
+            dectest::bench::do_not_optimize(format(value, buffer));
+        }
+    })};
+
+    const auto bytes_per_op {static_cast<double>(bytes) / static_cast<double>(values.size())};
+
+    std::cout << std::left << std::setw(36) << file << std::setw(22) << name << std::setw(14) << type
+              << std::right << std::setw(10) << values.size()
+              << std::fixed << std::setprecision(2)
+              << std::setw(12) << t.ns_per_op << std::setw(12) << bytes_per_op << std::setw(12) << bytes_per_op * t.ops_per_sec / 1e6
+              << std::defaultfloat << '\n';
+}
+
+template <typename T>
+void bench_file(const std::string& file, const char* type)
+{
+    const auto values {load_values<T>(file)};
+    if (values.empty())
+    {
+        return;
+    }
+
+    const auto chars = [](const chars_format fmt)
+    {
+        return [fmt](const T value, char* buffer) -> std::size_t
+        {
+            const auto r {to_chars(buffer, buffer + buffer_size, value, fmt)};
+            return r.ec == std::errc() ? static_cast<std::size_t>(r.ptr - buffer) : 0U;
+        };
+    };
+
+    bench_format(file, "to_chars scientific", type, values, chars(chars_format::scientific));
+    bench_format(file, "to_chars general", type, values, chars(chars_format::general));
+    bench_format(file, "to_chars fixed", type, values, chars(chars_format::fixed));
+
+    bench_format(file, "snprintf", type, values, [](const T value, char* buffer) -> std::size_t
+    {
+        const auto written {boost::decimal::snprintf(buffer, buffer_size, printf_format_string(value), value)};
+        return written > 0 ? static_cast<std::size_t>(written) : 0U;
+    });
+
+    // One stream for all the calls, as a serializer would keep one
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<T>::max_digits10);
+    bench_format(file, "operator<<", type, values, [&os](const T value, char*) -> std::size_t
+    {
+        os.seekp(0);
+        os << value;
+        return static_cast<std::size_t>(os.tellp());
+    });
+}
+
+template <typename T>
+void bench_all_files(const char* type)
+{
+    bench_file<T>("dectest/base.decTest", type);
+    bench_file<T>("dectest0/base0.decTest", type);
+    bench_file<T>("archive/dectest/dsBase.decTest", type);
+    bench_file<T>("archive/dectest/ddBase.decTest", type);
+    bench_file<T>("archive/dectest/dqBase.decTest", type);
+}
+
+int main()
+{
+    std::cout << std::left << std::setw(36) << "file" << std::setw(22) << "formatter" << std::setw(14) << "type"
+              << std::right << std::setw(10) << "values" << std::setw(12) << "ns/op" << std::setw(12) << "bytes/op"
+              << std::setw(12) << "MB/s" << '\n';
+
+    bench_all_files<decimal32_t>("decimal32_t");
+    bench_all_files<decimal64_t>("decimal64_t");
+    bench_all_files<decimal128_t>("decimal128_t");
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    std::cout << "Benchmarks not run" << std::endl;
+    return 0;
+}
+
+#endif
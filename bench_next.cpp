@@ -0,0 +1,161 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// nextafter, scalbn, logb and ilogb on the vectors of the dd and dq files of nextplus, nextminus, nexttoward,
+// scaleb and logb, as a price is stepped along a tick grid or bucketed by its exponent.
+// The vectors of each file are split by the first operand: its class, and for normal values whether its exponent
+// is the emin or the emax of the format, where most of the boundary cases of these files are.
+// Each group is timed on its own and against the normal values, so the slower column shows which ones leave the fast path.
+// decimal32_t has no such files
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_bench.hpp"
+
+#ifdef BOOST_DECIMAL_RUN_BENCHMARKS
+
+using namespace boost::decimal;
+
+template <typename T>
+struct operand_arrays
+{
+    std::vector<T> lhs;
+    std::vector<T> rhs;
+};
+
+// e.g. "subnormal" or "normal at emax"
+inline std::string boundary_class(const dectest::test_case& tc)
+{
+    const auto info {dectest::classify_operand(tc.operands[0], tc.ctx)};
+    if (info.cls == dectest::operand_class::normal && info.adjusted_exponent == tc.ctx.max_exponent)
+    {
+        return "normal at emax";
+    }
+    if (info.cls == dectest::operand_class::normal && info.adjusted_exponent == tc.ctx.min_exponent)
+    {
+        return "normal at emin";
+    }
+
+    return dectest::operand_class_name(info.cls);
+}
+
+template <typename T>
+std::vector<std::pair<std::string, operand_arrays<T>>> load_groups(const std::string& file, const std::string& op)
+{
+    std::vector<std::pair<std::string, operand_arrays<T>>> groups;
+
+    const auto found {dectest::for_each_case(file, op, [&](const dectest::test_case& tc)
+    {
+        int exponent {};
+        if (tc.flags != 0U || tc.operand_count == 0U ||
+            (op == "scaleb" && !dectest::detail::parse_int(tc.operands[1], exponent)))
+        {
+            return;
+        }
+
+        try
+        {
+            const auto lhs {dectest::make_decimal<T>(tc.operands[0])};
+            const auto rhs {tc.operand_count > 1U ? dectest::make_decimal<T>(tc.operands[1]) : T {}};
+
+            auto label {boundary_class(tc)};
+            auto group {std::find_if(groups.begin(), groups.end(), [&](const std::pair<std::string, operand_arrays<T>>& g) { return g.first == label; })};
+            if (group == groups.end())
+            {
+                groups.emplace_back(std::move(label), operand_arrays<T>());
+                group = groups.end() - 1;
+            }
+
+            group->second.lhs.push_back(lhs);
+            group->second.rhs.push_back(rhs);
+        }
+        catch (const dectest::invalid_operand&)
+        {
+            // Conversion syntax tests
+        }
+    })};
+
+    BOOST_TEST(found);
+    return groups;
+}
+
+template <typename T, typename Function>
+void bench_groups(const std::string& file, const std::string& op, const char* function, const char* type, Function f)
+{
+    const auto groups {load_groups<T>(file, op)};
+    BOOST_TEST(!groups.empty());
+
+    std::vector<dectest::bench::timing> times;
+    double normal_ns {};
+    for (const auto& group : groups)
+    {
+        const auto& arrays {group.second};
+        const auto count {arrays.lhs.size()};
+
+        times.push_back(dectest::bench::time_loop(count, [&]()
+        {
+            for (std::size_t i {}; i < count; ++i)
+            {
+                dectest::bench::do_not_optimize(f(arrays.lhs[i], arrays.rhs[i]));
+            }
+        }, std::chrono::milliseconds(20)));
+
+        if (group.first == "normal")
+        {
+            normal_ns = times.back().ns_per_op;
+        }
+    }
+
+    for (std::size_t i {}; i < groups.size(); ++i)
+    {
+        std::cout << std::left << std::setw(40) << file << std::setw(12) << function << std::setw(14) << type << std::setw(18) << groups[i].first
+                  << std::right << std::setw(10) << groups[i].second.lhs.size()
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(12) << times[i].ns_per_op << std::setw(12) << times[i].cycles_per_op;
+
+        if (normal_ns > 0)
+        {
+            std::cout << std::setw(11) << times[i].ns_per_op / normal_ns << 'x';
+        }
+
+        std::cout << std::defaultfloat << '\n';
+    }
+}
+
+template <typename T>
+void bench_width(const std::string& prefix, const char* type)
+{
+    const auto file = [&](const char* name) { return "archive/dectest/" + prefix + name + ".decTest"; };
+
+    bench_groups<T>(file("NextPlus"), "nextplus", "nextafter", type, [](const T x, const T) { return nextafter(x, std::numeric_limits<T>::infinity()); });
+    bench_groups<T>(file("NextMinus"), "nextminus", "nextafter", type, [](const T x, const T) { return nextafter(x, -std::numeric_limits<T>::infinity()); });
+    bench_groups<T>(file("NextToward"), "nexttoward", "nextafter", type, [](const T x, const T y) { return nextafter(x, y); });
+    bench_groups<T>(file("ScaleB"), "scaleb", "scalbn", type, [](const T x, const T y) { return scalbn(x, static_cast<int>(y)); });
+    bench_groups<T>(file("ScaleB"), "scaleb", "scalbln", type, [](const T x, const T y) { return scalbln(x, static_cast<long>(y)); });
+    bench_groups<T>(file("LogB"), "logb", "logb", type, [](const T x, const T) { return logb(x); });
+    bench_groups<T>(file("LogB"), "logb", "ilogb", type, [](const T x, const T) { return ilogb(x); });
+}
+
+int main()
+{
+    std::cout << std::left << std::setw(40) << "file" << std::setw(12) << "function" << std::setw(14) << "type" << std::setw(18) << "operand"
+              << std::right << std::setw(10) << "vectors" << std::setw(12) << "ns/op" << std::setw(12) << "cycles/op"
+              << std::setw(12) << "vs normal" << '\n';
+
+    bench_width<decimal64_t>("dd", "decimal64_t");
+    bench_width<decimal128_t>("dq", "decimal128_t");
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    std::cout << "Benchmarks not run" << std::endl;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,205 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Throughput of the string to decimal conversions over the toSci inputs of the base files,
+// which cover exponents, leading and trailing zeros, signs, specials and every kind of malformed number.
+// The string constructor, from_chars and strtod are timed on the same strings,
+// their allocations counted, and their results compared bit for bit
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_bench.hpp"
+
+#ifdef BOOST_DECIMAL_RUN_BENCHMARKS
+
+#include <new>
+#include <cstdlib>
+
+// Count every allocation made through operator new in this program
+static std::size_t allocation_count {};
+
+void* operator new(std::size_t size)
+{
+    ++allocation_count;
+
+    if (void* ptr = std::malloc(size == 0U ? 1U : size))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+using namespace boost::decimal;
+
+decimal32_t parse_strtod(const char* str, decimal32_t, char** end) { return strtod32(str, end); }
+decimal64_t parse_strtod(const char* str, decimal64_t, char** end) { return strtod64(str, end); }
+decimal128_t parse_strtod(const char* str, decimal128_t, char** end) { return strtod128(str, end); }
+
+// The toSci inputs of file whose precision selects T, as the harness would choose it.
+// Only strings that from_chars takes whole are kept, the others are counted in rejected
+template <typename T>
+std::vector<std::string> load_inputs(const std::string& file, std::size_t& rejected)
+{
+    std::vector<std::string> inputs;
+
+    const auto found {dectest::for_each_case(file, "toSci", [&](const dectest::test_case& tc)
+    {
+        const auto width {dectest::detail::width_of(tc.ctx.precision)};
+        if (tc.operand_count != 1U || (tc.flags & dectest::case_flags::hash_marker) != 0U || width != dectest::detail::width_of(std::numeric_limits<T>::digits))
+        {
+            return;
+        }
+
+        try
+        {
+            static_cast<void>(dectest::make_decimal<T>(tc.operands[0]));
+            inputs.emplace_back(tc.operands[0].data(), tc.operands[0].size());
+        }
+        catch (const dectest::invalid_operand&)
+        {
+            ++rejected;
+        }
+    })};
+
+    BOOST_TEST(found);
+    return inputs;
+}
+
+template <typename T>
+bool same_bits(const T lhs, const T rhs)
+{
+    return to_bid(lhs) == to_bid(rhs);
+}
+
+// Allocations per call of parse over all of the inputs
+template <typename Function>
+double allocations_per_parse(const std::vector<std::string>& inputs, Function parse)
+{
+    const auto before {allocation_count};
+    for (const auto& str : inputs)
+    {
+        dectest::bench::do_not_optimize(parse(str));
+    }
+
+    return static_cast<double>(allocation_count - before) / static_cast<double>(inputs.size());
+}
+
+template <typename T, typename Function>
+void bench_entry_point(const std::string& file, const char* name, const char* type, const std::vector<std::string>& inputs, Function parse)
+{
+    const auto t {dectest::bench::time_loop(inputs.size(), [&]()
+    {
+        for (const auto& str : inputs)
+        {
+            dectest::bench::do_not_optimize(parse(str));
+        }
+    })};
+
+    const auto allocations {allocations_per_parse(inputs, parse)};
+
+    std::cout << std::left << std::setw(36) << file << std::setw(12) << name << std::setw(14) << type
+              << std::right << std::setw(10) << inputs.size()
+              << std::fixed << std::setprecision(2)
+              << std::setw(12) << t.ns_per_op << std::setw(14) << t.ops_per_sec / 1e6 << std::setw(12) << t.cycles_per_op
+              << std::setw(14) << allocations
+              << std::defaultfloat << '\n';
+}
+
+template <typename T>
+void bench_file(const std::string& file, const char* type)
+{
+    std::size_t rejected {};
+    const auto inputs {load_inputs<T>(file, rejected)};
+    if (inputs.empty())
+    {
+        return;
+    }
+
+    const auto construct = [](const std::string& str) { return T {str}; };
+
+    const auto chars = [](const std::string& str)
+    {
+        T value;
+        const auto r {from_chars(str.data(), str.data() + str.size(), value)};
+        static_cast<void>(r);
+        return value;
+    };
+
+    const auto c_parse = [](const std::string& str)
+    {
+        char* end {};
+        return parse_strtod(str.c_str(), T {}, &end);
+    };
+
+    // Every entry point has to give the same encoding
+    std::size_t agreed {};
+    for (const auto& str : inputs)
+    {
+        const auto expected {chars(str)};
+        if (BOOST_TEST(same_bits(construct(str), expected)) && BOOST_TEST(same_bits(c_parse(str), expected)))
+        {
+            ++agreed;
+        }
+        else
+        {
+            std::cerr << "Entry points disagree on: " << str << std::endl;
+        }
+    }
+
+    BOOST_TEST_EQ(agreed, inputs.size());
+
+    bench_entry_point<T>(file, "string ctor", type, inputs, construct);
+    bench_entry_point<T>(file, "from_chars", type, inputs, chars);
+    bench_entry_point<T>(file, "strtod", type, inputs, c_parse);
+
+    if (rejected > 0U)
+    {
+        std::cout << std::string(36, ' ') << rejected << " malformed inputs not timed\n";
+    }
+}
+
+template <typename T>
+void bench_all_files(const char* type)
+{
+    bench_file<T>("dectest/base.decTest", type);
+    bench_file<T>("dectest0/base0.decTest", type);
+    bench_file<T>("archive/dectest/dsBase.decTest", type);
+    bench_file<T>("archive/dectest/ddBase.decTest", type);
+    bench_file<T>("archive/dectest/dqBase.decTest", type);
+}
+
+int main()
+{
+    std::cout << std::left << std::setw(36) << "file" << std::setw(12) << "parser" << std::setw(14) << "type"
+              << std::right << std::setw(10) << "inputs" << std::setw(12) << "ns/parse" << std::setw(14) << "Mparses/s"
+              << std::setw(12) << "cycles" << std::setw(14) << "allocs/parse" << '\n';
+
+    bench_all_files<decimal32_t>("decimal32_t");
+    bench_all_files<decimal64_t>("decimal64_t");
+    bench_all_files<decimal128_t>("decimal128_t");
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    std::cout << "Benchmarks not run" << std::endl;
+    return 0;
+}
+
+#endif
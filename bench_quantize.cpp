@@ -0,0 +1,141 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// quantize to a fixed number of decimal places, as a ledger rounds amounts to cents or a rate to 4 or 8 places.
+// The finite operands of ddQuantize and dqQuantize are repeated into a large array of each width,
+// quantized to 2, 4 and 8 places under half_even (banker's rounding) and half_up (commercial rounding),
+// and timed as the median of repeated loops. Each result is checked to have the exponent it was quantized to
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_bench.hpp"
+
+#ifdef BOOST_DECIMAL_RUN_BENCHMARKS
+
+using namespace boost::decimal;
+
+// Large enough to leave the cache lines of the file behind, as a batch of amounts would
+constexpr std::size_t amount_count {std::size_t(1) << 16U};
+
+// The finite lhs operands of the quantize files that fit in T once quantized to places decimal places,
+// repeated up to amount_count
+template <typename T>
+std::vector<T> load_amounts(const int places)
+{
+    std::vector<T> operands;
+    const T target {1, -places};
+
+    for (const auto file : {"archive/dectest/ddQuantize.decTest", "archive/dectest/dqQuantize.decTest"})
+    {
+        const auto found {dectest::for_each_case(file, "quantize", [&](const dectest::test_case& tc)
+        {
+            if (tc.flags != 0U || tc.operand_count != 2U)
+            {
+                return;
+            }
+
+            try
+            {
+                const auto x {dectest::make_decimal<T>(tc.operands[0])};
+                if (isfinite(x) && isfinite(quantize(x, target)))
+                {
+                    operands.push_back(x);
+                }
+            }
+            catch (const dectest::invalid_operand&)
+            {
+                // Conversion syntax tests
+            }
+        })};
+
+        BOOST_TEST(found);
+    }
+
+    std::vector<T> amounts;
+    if (!operands.empty())
+    {
+        amounts.reserve(amount_count);
+        for (std::size_t i {}; i < amount_count; ++i)
+        {
+            amounts.push_back(operands[i % operands.size()]);
+        }
+    }
+
+    return amounts;
+}
+
+template <typename T>
+void bench_quantize(const char* type, const int places, const dectest::rounding round)
+{
+    const auto entry_round {boost::decimal::fegetround()};
+    if (!set_dectest_rounding(round))
+    {
+        return;
+    }
+
+    // The operands are filtered under the mode of the run, which decides whether a result carries into a new digit
+    const auto amounts {load_amounts<T>(places)};
+    const auto count {amounts.size()};
+    const T target {1, -places};
+
+    std::size_t wrong_quantum {};
+    for (const auto x : amounts)
+    {
+        if (!samequantum(quantize(x, target), target))
+        {
+            ++wrong_quantum;
+        }
+    }
+
+    const auto t {dectest::bench::time_repeated(dectest::bench::repeats_from_environment(), count, [&]()
+    {
+        for (std::size_t i {}; i < count; ++i)
+        {
+            dectest::bench::do_not_optimize(quantize(amounts[i], target));
+        }
+    })};
+
+    boost::decimal::fesetround(entry_round);
+
+    BOOST_TEST_GT(count, 0U);
+    BOOST_TEST_EQ(wrong_quantum, 0U);
+
+    std::cout << std::left << std::setw(14) << type << std::right << std::setw(8) << places
+              << std::left << "  " << std::setw(12) << dectest::rounding_name(round)
+              << std::right << std::setw(10) << count
+              << std::fixed << std::setprecision(2)
+              << std::setw(12) << t.ns_per_op << std::setw(10) << t.ns_mad << std::setw(12) << t.cycles_per_op
+              << std::defaultfloat << '\n';
+}
+
+int main()
+{
+    std::cout << std::left << std::setw(14) << "type" << std::right << std::setw(8) << "places"
+              << std::left << "  " << std::setw(12) << "rounding"
+              << std::right << std::setw(10) << "vectors" << std::setw(12) << "ns/op" << std::setw(10) << "MAD"
+              << std::setw(12) << "cycles/op" << '\n';
+
+    for (const auto round : {dectest::rounding::half_even, dectest::rounding::half_up})
+    {
+        for (const auto places : {2, 4, 8})
+        {
+            bench_quantize<decimal32_t>("decimal32_t", places, round);
+            bench_quantize<decimal64_t>("decimal64_t", places, round);
+            bench_quantize<decimal128_t>("decimal128_t", places, round);
+        }
+    }
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    std::cout << "Benchmarks not run" << std::endl;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,138 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The functions that round to an integral value, on the operands of the tointegral files, as amounts are rounded
+// to whole currency units. Each function is timed over all the operands of a width as the median of repeated loops,
+// and checked on the cases of the rounding mode it implements (see dectest_runner::add_to_integral):
+// nearbyint and rint in the default half_even, round half_up, trunc down, floor and ceil their namesakes.
+// Only the cases whose result is a reference for the width are used (see result_fits_width)
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_bench.hpp"
+
+#ifdef BOOST_DECIMAL_RUN_BENCHMARKS
+
+using namespace boost::decimal;
+
+template <typename T>
+struct integral_cases
+{
+    std::vector<T> x;
+    std::vector<T> expected;
+    std::vector<dectest::rounding> round;
+};
+
+template <typename T>
+integral_cases<T> load_integral_cases()
+{
+    integral_cases<T> cases;
+    const auto width {dectest::detail::width_of(std::numeric_limits<T>::digits)};
+
+    for (const auto file : {"archive/dectest/ddToIntegral.decTest", "archive/dectest/dqToIntegral.decTest",
+                            "archive/dectest/tointegral.decTest", "archive/dectest/tointegralx.decTest"})
+    {
+        const auto found {dectest::for_each_case(file, [&](const dectest::test_case& tc)
+        {
+            if (tc.flags != 0U || tc.operand_count != 1U || (tc.op != "tointegral" && tc.op != "tointegralx") ||
+                dectest::detail::width_of(tc.ctx.precision) != width || !dectest::result_fits_width(tc, width))
+            {
+                return;
+            }
+
+            try
+            {
+                const auto x {dectest::make_decimal<T>(tc.operands[0])};
+                const auto expected {dectest::make_decimal<T>(tc.result)};
+                cases.x.push_back(x);
+                cases.expected.push_back(expected);
+                cases.round.push_back(tc.ctx.round);
+            }
+            catch (const dectest::invalid_operand&)
+            {
+                // Conversion syntax tests
+            }
+        })};
+
+        BOOST_TEST(found);
+    }
+
+    return cases;
+}
+
+template <typename T, typename Function>
+void bench_function(const integral_cases<T>& cases, const char* type, const char* function, const dectest::rounding round, Function f)
+{
+    const auto count {cases.x.size()};
+
+    std::size_t checked {};
+    std::size_t correct {};
+    for (std::size_t i {}; i < count; ++i)
+    {
+        if (cases.round[i] == round)
+        {
+            const auto result {f(cases.x[i])};
+            ++checked;
+
+            if (result == cases.expected[i] || (isnan(result) && isnan(cases.expected[i])))
+            {
+                ++correct;
+            }
+        }
+    }
+
+    const auto t {dectest::bench::time_repeated(dectest::bench::repeats_from_environment(), count, [&]()
+    {
+        for (std::size_t i {}; i < count; ++i)
+        {
+            dectest::bench::do_not_optimize(f(cases.x[i]));
+        }
+    })};
+
+    BOOST_TEST_GT(count, 0U);
+    BOOST_TEST_EQ(correct, checked);
+
+    std::cout << std::left << std::setw(14) << type << std::setw(12) << function << std::setw(12) << dectest::rounding_name(round)
+              << std::right << std::setw(10) << count
+              << std::fixed << std::setprecision(2)
+              << std::setw(12) << t.ns_per_op << std::setw(10) << t.ns_mad << std::setw(12) << t.cycles_per_op
+              << std::defaultfloat << std::setw(10) << correct << '/' << checked << '\n';
+}
+
+template <typename T>
+void bench_width(const char* type)
+{
+    const auto cases {load_integral_cases<T>()};
+
+    bench_function(cases, type, "nearbyint", dectest::rounding::half_even, [](const T x) { return nearbyint(x); });
+    bench_function(cases, type, "rint", dectest::rounding::half_even, [](const T x) { return rint(x); });
+    bench_function(cases, type, "round", dectest::rounding::half_up, [](const T x) { return round(x); });
+    bench_function(cases, type, "trunc", dectest::rounding::down, [](const T x) { return trunc(x); });
+    bench_function(cases, type, "floor", dectest::rounding::floor, [](const T x) { return floor(x); });
+    bench_function(cases, type, "ceil", dectest::rounding::ceiling, [](const T x) { return ceil(x); });
+}
+
+int main()
+{
+    std::cout << std::left << std::setw(14) << "type" << std::setw(12) << "function" << std::setw(12) << "rounding"
+              << std::right << std::setw(10) << "vectors" << std::setw(12) << "ns/op" << std::setw(10) << "MAD"
+              << std::setw(12) << "cycles/op" << std::setw(14) << "correct" << '\n';
+
+    bench_width<decimal32_t>("decimal32_t");
+    bench_width<decimal64_t>("decimal64_t");
+    bench_width<decimal128_t>("decimal128_t");
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    std::cout << "Benchmarks not run" << std::endl;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,175 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Accuracy against speed of exp, log and log10 on the operands of the archive files.
+// Each width is run on the cases whose result is a reference for it (see result_rounded_to_width),
+// timed as the median of repeated loops and checked to the exact ULP.
+// The last table marks the widths no other width beats in both speed and correct digits,
+// and names the cheapest width that reaches BOOST_DECIMAL_DECTEST_DIGITS correct digits (7 by default)
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_bench.hpp"
+
+#ifdef BOOST_DECIMAL_RUN_BENCHMARKS
+
+#include <cmath>
+
+using namespace boost::decimal;
+
+struct function_result
+{
+    std::string function;
+    const char* type;
+    std::size_t vectors;
+    double ns_per_op;
+    std::size_t max_ulp;
+    double correct_digits;
+};
+
+template <typename T>
+struct reference_arrays
+{
+    std::vector<T> x;
+    std::vector<T> expected;
+};
+
+template <typename T>
+reference_arrays<T> load_references(const std::string& file, const std::string& op)
+{
+    reference_arrays<T> arrays;
+    const auto width {dectest::detail::width_of(std::numeric_limits<T>::digits)};
+
+    const auto found {dectest::for_each_case(file, op, [&](const dectest::test_case& tc)
+    {
+        if (tc.flags != 0U || tc.operand_count != 1U || !dectest::result_rounded_to_width(tc, width))
+        {
+            return;
+        }
+
+        try
+        {
+            const auto x {dectest::make_decimal<T>(tc.operands[0])};
+            const auto expected {dectest::make_decimal<T>(tc.result)};
+            arrays.x.push_back(x);
+            arrays.expected.push_back(expected);
+        }
+        catch (const dectest::invalid_operand&)
+        {
+            // Conversion syntax tests
+        }
+    })};
+
+    BOOST_TEST(found);
+    return arrays;
+}
+
+template <typename T, typename Function>
+function_result bench_function(const std::string& file, const std::string& op, const char* type, Function f)
+{
+    const auto arrays {load_references<T>(file, op)};
+    const auto count {arrays.x.size()};
+
+    dectest::ulp_histogram errors;
+    for (std::size_t i {}; i < count; ++i)
+    {
+        errors.record(ulp_distance(f(arrays.x[i]), arrays.expected[i]));
+    }
+
+    const auto t {dectest::bench::time_repeated(dectest::bench::repeats_from_environment(), count, [&]()
+    {
+        for (std::size_t i {}; i < count; ++i)
+        {
+            dectest::bench::do_not_optimize(f(arrays.x[i]));
+        }
+    })};
+
+    BOOST_TEST_GT(count, 0U);
+
+    // An error of up to 1 ULP still leaves every digit but the last one right
+    const auto max_ulp {errors.max()};
+    const auto digits {static_cast<double>(std::numeric_limits<T>::digits) - std::log10(static_cast<double>(std::max(max_ulp, std::size_t(1))))};
+
+    std::cout << std::left << std::setw(36) << file << std::setw(8) << op << std::setw(14) << type
+              << std::right << std::setw(10) << count << std::setw(10) << errors.count(0U) << std::setw(14) << max_ulp
+              << std::fixed << std::setprecision(2)
+              << std::setw(12) << t.ns_per_op << std::setw(10) << t.ns_mad << std::setw(12) << t.cycles_per_op
+              << std::defaultfloat << '\n';
+
+    return function_result {op, type, count, t.ns_per_op, max_ulp, digits};
+}
+
+template <typename Function>
+void bench_all_widths(std::vector<function_result>& results, const std::string& file, const std::string& op, Function f)
+{
+    results.push_back(bench_function<decimal32_t>(file, op, "decimal32_t", f));
+    results.push_back(bench_function<decimal64_t>(file, op, "decimal64_t", f));
+    results.push_back(bench_function<decimal128_t>(file, op, "decimal128_t", f));
+}
+
+int main()
+{
+    const auto target {[]
+    {
+        const char* env {dectest::detail::environment("BOOST_DECIMAL_DECTEST_DIGITS")};
+        return env == nullptr ? 7.0 : std::atof(env);
+    }()};
+
+    std::cout << std::left << std::setw(36) << "file" << std::setw(8) << "op" << std::setw(14) << "type"
+              << std::right << std::setw(10) << "vectors" << std::setw(10) << "exact" << std::setw(14) << "max ULP"
+              << std::setw(12) << "ns/op" << std::setw(10) << "MAD" << std::setw(12) << "cycles/op" << '\n';
+
+    std::vector<function_result> results;
+    bench_all_widths(results, "archive/dectest/exp.decTest", "exp", [](const auto x) { return exp(x); });
+    bench_all_widths(results, "archive/dectest/ln.decTest", "ln", [](const auto x) { return log(x); });
+    bench_all_widths(results, "archive/dectest/log10.decTest", "log10", [](const auto x) { return log10(x); });
+
+    // A width is on the front when no other width of the function is at least as fast and as accurate, and better in one
+    std::cout << '\n' << std::left << std::setw(8) << "op" << std::setw(14) << "type" << std::right << std::setw(12) << "ns/op"
+              << std::setw(16) << "correct digits" << std::setw(8) << "front" << '\n';
+
+    for (const auto& r : results)
+    {
+        const auto dominated {std::any_of(results.begin(), results.end(), [&](const function_result& other)
+        {
+            return other.function == r.function && other.ns_per_op <= r.ns_per_op && other.correct_digits >= r.correct_digits &&
+                   (other.ns_per_op < r.ns_per_op || other.correct_digits > r.correct_digits);
+        })};
+
+        std::cout << std::left << std::setw(8) << r.function << std::setw(14) << r.type
+                  << std::right << std::fixed << std::setprecision(2) << std::setw(12) << r.ns_per_op
+                  << std::setprecision(1) << std::setw(16) << r.correct_digits << std::defaultfloat
+                  << std::setw(8) << (dominated ? "" : "*") << '\n';
+    }
+
+    std::cout << '\n';
+    for (std::size_t i {}; i < results.size(); i += 3U)
+    {
+        const function_result* cheapest {nullptr};
+        for (std::size_t j {i}; j < i + 3U; ++j)
+        {
+            if (results[j].vectors > 0U && results[j].correct_digits >= target &&
+                (cheapest == nullptr || results[j].ns_per_op < cheapest->ns_per_op))
+            {
+                cheapest = &results[j];
+            }
+        }
+
+        std::cout << "Cheapest " << results[i].function << " with " << target << " correct digits: "
+                  << (cheapest == nullptr ? "none" : cheapest->type) << '\n';
+    }
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    std::cout << "Benchmarks not run" << std::endl;
+    return 0;
+}
+
+#endif
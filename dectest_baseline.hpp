@@ -0,0 +1,400 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_BASELINE_HPP
+#define BOOST_DECIMAL_DECTEST_BASELINE_HPP
+
+// Stored benchmark results, to catch a slower Boost.Decimal before it ships.
+//
+// With BOOST_DECIMAL_DECTEST_BASELINE=FILE bench_dectest writes the median ns/op and cycles/op of each
+// file, op, type and rounding mode to FILE, with the compiler and the machine they were measured on.
+// dectest_compare then checks a new run against a stored one and fails when an op got slower by more than
+// a threshold. Each time is the median of repeated loops, and a change smaller than the spread (MAD) of the
+// repeats is taken as noise, whatever its percentage. The file is CSV, the metadata lines start with '#':
+//
+//   # compiler,GCC 13.2.0
+//   file,op,type,rounding,vectors,ns_per_op,ns_mad,cycles_per_op,repeats
+//   dectest/ddAdd.decTest,add,decimal64_t,half_even,1227,24.10,0.12,80.33,5
+
+#include "dectest_bench.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/utsname.h>
+#  define BOOST_DECIMAL_DECTEST_HAS_UNAME
+#endif
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+namespace bench {
+
+struct baseline_entry
+{
+    std::string file;
+    std::string op;
+    std::string type;
+    std::string rounding;
+    std::size_t vectors {};
+    double ns_per_op {};
+    double ns_mad {};
+    double cycles_per_op {};
+    std::size_t repeats {};
+};
+
+struct baseline
+{
+    // Key and value pairs, e.g. compiler and machine
+    std::vector<std::pair<std::string, std::string>> metadata;
+    std::vector<baseline_entry> entries;
+
+    const std::string& find_metadata(const std::string& key) const
+    {
+        static const std::string none;
+        for (const auto& m : metadata)
+        {
+            if (m.first == key)
+            {
+                return m.second;
+            }
+        }
+
+        return none;
+    }
+
+    const baseline_entry* find(const baseline_entry& e) const noexcept
+    {
+        for (const auto& entry : entries)
+        {
+            if (entry.file == e.file && entry.op == e.op && entry.type == e.type && entry.rounding == e.rounding)
+            {
+                return &entry;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+namespace detail {
+
+inline std::string compiler_name()
+{
+    #if defined(__clang__)
+    return std::string("Clang ") + __clang_version__;
+    #elif defined(__GNUC__)
+    return std::string("GCC ") + __VERSION__;
+    #elif defined(_MSC_VER)
+    return "MSVC " + std::to_string(_MSC_FULL_VER);
+    #else
+    return "unknown";
+    #endif
+}
+
+inline std::string machine_name()
+{
+    #if defined(BOOST_DECIMAL_DECTEST_HAS_UNAME)
+    utsname name;
+    if (uname(&name) == 0)
+    {
+        return std::string(name.sysname) + ' ' + name.release + ' ' + name.machine;
+    }
+    return "unknown";
+    #elif defined(_WIN32)
+    return "Windows";
+    #else
+    return "unknown";
+    #endif
+}
+
+// The model name of the first CPU in /proc/cpuinfo, empty elsewhere
+inline std::string cpu_name()
+{
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line))
+    {
+        if (line.compare(0, 10, "model name") == 0)
+        {
+            const auto colon {line.find(':')};
+            if (colon != std::string::npos && colon + 2U <= line.size())
+            {
+                return line.substr(colon + 2U);
+            }
+        }
+    }
+
+    return std::string();
+}
+
+inline std::string utc_date()
+{
+    const auto now {std::time(nullptr)};
+    char buffer[32] {};
+    std::tm tm {};
+
+    #ifdef _WIN32
+    gmtime_s(&tm, &now);
+    #else
+    gmtime_r(&now, &tm);
+    #endif
+
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &tm);
+
+    return buffer;
+}
+
+// Commas and line breaks would split a field, the metadata strings should not have any
+inline std::string csv_field(std::string str)
+{
+    for (auto& c : str)
+    {
+        if (c == ',' || c == '\n' || c == '\r')
+        {
+            c = ' ';
+        }
+    }
+
+    return str;
+}
+
+inline std::vector<std::string> split_csv(const std::string& line)
+{
+    std::vector<std::string> fields;
+    std::size_t start {};
+    for (;;)
+    {
+        const auto comma {line.find(',', start)};
+        fields.push_back(line.substr(start, comma == std::string::npos ? std::string::npos : comma - start));
+        if (comma == std::string::npos)
+        {
+            return fields;
+        }
+        start = comma + 1U;
+    }
+}
+
+} // namespace detail
+
+// The compiler, build, machine and date of this run
+inline std::vector<std::pair<std::string, std::string>> current_metadata()
+{
+    std::vector<std::pair<std::string, std::string>> metadata {
+        {"compiler", detail::compiler_name()},
+        {"machine", detail::machine_name()},
+        {"cpu", detail::cpu_name()},
+        {"date", detail::utc_date()}
+    };
+
+    #ifdef NDEBUG
+    metadata.emplace_back("build", "release");
+    #else
+    metadata.emplace_back("build", "debug");
+    #endif
+
+    #ifdef BOOST_VERSION
+    metadata.emplace_back("boost", std::to_string(BOOST_VERSION));
+    #endif
+
+    return metadata;
+}
+
+inline bool write_baseline(const std::string& path, const baseline& b)
+{
+    std::ofstream out(path.c_str());
+    if (!out.is_open())
+    {
+        return false;
+    }
+
+    for (const auto& m : b.metadata)
+    {
+        out << "# " << detail::csv_field(m.first) << ',' << detail::csv_field(m.second) << '\n';
+    }
+
+    out << "file,op,type,rounding,vectors,ns_per_op,ns_mad,cycles_per_op,repeats\n";
+
+    out << std::fixed << std::setprecision(3);
+    for (const auto& e : b.entries)
+    {
+        out << detail::csv_field(e.file) << ',' << detail::csv_field(e.op) << ',' << detail::csv_field(e.type) << ','
+            << detail::csv_field(e.rounding) << ',' << e.vectors << ',' << e.ns_per_op << ',' << e.ns_mad << ','
+            << e.cycles_per_op << ',' << e.repeats << '\n';
+    }
+
+    return static_cast<bool>(out);
+}
+
+// Returns false if path can not be read or has a malformed line
+inline bool read_baseline(const std::string& path, baseline& b)
+{
+    std::ifstream in(path.c_str());
+    if (!in.is_open())
+    {
+        return false;
+    }
+
+    const auto to_double = [](const std::string& str, double& value)
+    {
+        char* end {};
+        value = std::strtod(str.c_str(), &end);
+        return !str.empty() && *end == '\0';
+    };
+
+    const auto to_size = [](const std::string& str, std::size_t& value)
+    {
+        char* end {};
+        value = static_cast<std::size_t>(std::strtoull(str.c_str(), &end, 10));
+        return !str.empty() && *end == '\0';
+    };
+
+    std::string line;
+    bool header {};
+    while (std::getline(in, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+
+        if (line.empty())
+        {
+            continue;
+        }
+
+        if (line.compare(0, 2, "# ") == 0)
+        {
+            const auto comma {line.find(',')};
+            if (comma == std::string::npos)
+            {
+                return false;
+            }
+
+            b.metadata.emplace_back(line.substr(2U, comma - 2U), line.substr(comma + 1U));
+            continue;
+        }
+
+        if (!header)
+        {
+            header = line.compare(0, 5, "file,") == 0;
+            if (!header)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        const auto fields {detail::split_csv(line)};
+        if (fields.size() != 9U)
+        {
+            return false;
+        }
+
+        baseline_entry e;
+        e.file = fields[0];
+        e.op = fields[1];
+        e.type = fields[2];
+        e.rounding = fields[3];
+        if (!to_size(fields[4], e.vectors) || !to_double(fields[5], e.ns_per_op) || !to_double(fields[6], e.ns_mad) ||
+            !to_double(fields[7], e.cycles_per_op) || !to_size(fields[8], e.repeats))
+        {
+            return false;
+        }
+
+        b.entries.push_back(std::move(e));
+    }
+
+    return header;
+}
+
+// MAD times 1.4826 estimates the standard deviation of normally distributed times
+constexpr double mad_to_sigma {1.4826};
+
+struct comparison_options
+{
+    // How much slower than the baseline, in percent, an op may get
+    double threshold_percent {5};
+
+    // A change below sigmas standard deviations of the two runs combined is noise
+    double sigmas {3};
+};
+
+// Prints the change of each entry of current against its baseline and returns the number of regressions:
+// entries slower by more than the threshold and by more than the noise of the two runs
+inline std::size_t compare_baselines(const baseline& stored, const baseline& current,
+                                     const comparison_options& options = comparison_options(), std::ostream& os = std::cout)
+{
+    for (const auto key : {"compiler", "machine", "cpu", "build"})
+    {
+        if (stored.find_metadata(key) != current.find_metadata(key))
+        {
+            os << "Note: the " << key << " differs, " << stored.find_metadata(key) << " against "
+               << current.find_metadata(key) << '\n';
+        }
+    }
+
+    os << std::left << std::setw(36) << "file" << std::setw(12) << "op" << std::setw(14) << "type" << std::setw(12) << "rounding"
+       << std::right << std::setw(12) << "base ns/op" << std::setw(12) << "ns/op" << std::setw(10) << "change" << "  verdict\n";
+
+    std::size_t regressions {};
+    for (const auto& e : current.entries)
+    {
+        const auto old {stored.find(e)};
+        if (old == nullptr)
+        {
+            continue;
+        }
+
+        const auto difference {e.ns_per_op - old->ns_per_op};
+        const auto change {old->ns_per_op > 0 ? 100 * difference / old->ns_per_op : 0};
+        const auto noise {options.sigmas * mad_to_sigma * std::sqrt(old->ns_mad * old->ns_mad + e.ns_mad * e.ns_mad)};
+
+        const char* verdict {""};
+        if (std::fabs(difference) <= noise)
+        {
+            verdict = "noise";
+        }
+        else if (change > options.threshold_percent)
+        {
+            verdict = "REGRESSION";
+            ++regressions;
+        }
+        else if (change < -options.threshold_percent)
+        {
+            verdict = "faster";
+        }
+
+        os << std::left << std::setw(36) << e.file << std::setw(12) << e.op << std::setw(14) << e.type << std::setw(12) << e.rounding
+           << std::right << std::fixed << std::setprecision(2) << std::setw(12) << old->ns_per_op << std::setw(12) << e.ns_per_op
+           << std::setprecision(1) << std::showpos << std::setw(9) << change << '%' << std::noshowpos << std::defaultfloat
+           << "  " << verdict << '\n';
+    }
+
+    for (const auto& e : stored.entries)
+    {
+        if (current.find(e) == nullptr)
+        {
+            os << "Not in the new run: " << e.file << ' ' << e.op << ' ' << e.type << ' ' << e.rounding << '\n';
+        }
+    }
+
+    return regressions;
+}
+
+} // namespace bench
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_BASELINE_HPP
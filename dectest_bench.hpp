@@ -0,0 +1,204 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_BENCH_HPP
+#define BOOST_DECIMAL_DECTEST_BENCH_HPP
+
+// Timing helpers shared by the benchmarks that run over the decTest vectors.
+// The benchmarks only do work when BOOST_DECIMAL_RUN_BENCHMARKS is defined, like the ones in Boost.Decimal,
+// and should be built with optimizations (e.g. b2 variant=release define=BOOST_DECIMAL_RUN_BENCHMARKS)
+
+#include "dectest_tokenizer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#  define BOOST_DECIMAL_DECTEST_HAS_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  include <x86intrin.h>
+#  define BOOST_DECIMAL_DECTEST_HAS_RDTSC
+#endif
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+namespace bench {
+
+// Time stamp counter, or 0 where there is none.
+// On current x86 this counts at a constant reference rate rather than the core clock,
+// so cycles/op is comparable between runs on one machine but not across machines
+inline std::uint64_t cycles() noexcept
+{
+    #ifdef BOOST_DECIMAL_DECTEST_HAS_RDTSC
+    return static_cast<std::uint64_t>(__rdtsc());
+    #else
+    return 0U;
+    #endif
+}
+
+// Keeps the compiler from discarding a result that is otherwise unused
+template <typename T>
+inline void do_not_optimize(const T& value) noexcept
+{
+    #if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+    #else
+    static_cast<void>(*static_cast<const volatile char*>(static_cast<const volatile void*>(&value)));
+    #endif
+}
+
+struct timing
+{
+    std::size_t ops {};
+    double ns_per_op {};
+    double ops_per_sec {};
+    double cycles_per_op {};
+
+    // Median absolute deviation of ns_per_op over the repeats of time_repeated, 0 for a single loop
+    double ns_mad {};
+    std::size_t repeats {1U};
+};
+
+// The median of values, 0 when it is empty
+inline double median(std::vector<double> values)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+
+    std::sort(values.begin(), values.end());
+    const auto middle {values.size() / 2U};
+    return values.size() % 2U == 1U ? values[middle] : (values[middle - 1U] + values[middle]) / 2;
+}
+
+// The median of the distances to the median, unlike the standard deviation
+// one repeat disturbed by another process does not change it
+inline double median_absolute_deviation(const std::vector<double>& values)
+{
+    const auto center {median(values)};
+
+    std::vector<double> deviations;
+    deviations.reserve(values.size());
+    for (const auto value : values)
+    {
+        deviations.push_back(std::fabs(value - center));
+    }
+
+    return median(std::move(deviations));
+}
+
+// $BOOST_DECIMAL_DECTEST_BENCH_REPEATS, 5 when it is not set or not a positive number
+inline std::size_t repeats_from_environment() noexcept
+{
+    const char* env {detail::environment("BOOST_DECIMAL_DECTEST_BENCH_REPEATS")};
+
+    if (env != nullptr)
+    {
+        const auto repeats {std::strtoul(env, nullptr, 10)};
+        if (repeats > 0U)
+        {
+            return static_cast<std::size_t>(repeats);
+        }
+    }
+
+    return 5U;
+}
+
+// Calls body() until at least min_time has passed, body performs ops_per_call operations per call
+template <typename Function>
+timing time_loop(const std::size_t ops_per_call, Function&& body, const std::chrono::milliseconds min_time = std::chrono::milliseconds(200))
+{
+    // One untimed call to warm the caches and the branch predictors
+    body();
+
+    timing t;
+    if (ops_per_call == 0U)
+    {
+        return t;
+    }
+
+    std::size_t calls {};
+    const auto start_cycles {cycles()};
+    const auto start {std::chrono::steady_clock::now()};
+    auto elapsed {std::chrono::steady_clock::duration::zero()};
+
+    do
+    {
+        body();
+        ++calls;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed < min_time);
+
+    const auto end_cycles {cycles()};
+
+    t.ops = calls * ops_per_call;
+    const auto ops {static_cast<double>(t.ops)};
+    const auto ns {std::chrono::duration<double, std::nano>(elapsed).count()};
+    t.ns_per_op = ns / ops;
+    t.ops_per_sec = ops / (ns / 1e9);
+    t.cycles_per_op = static_cast<double>(end_cycles - start_cycles) / ops;
+
+    return t;
+}
+
+// Repeats time_loop and keeps the medians, so that a repeat slowed down by the rest of the machine does not count
+template <typename Function>
+timing time_repeated(const std::size_t repeats, const std::size_t ops_per_call, Function&& body,
+                     const std::chrono::milliseconds min_time = std::chrono::milliseconds(50))
+{
+    std::vector<double> ns;
+    std::vector<double> cycles_per_op;
+    std::size_t ops {};
+
+    for (std::size_t i {}; i < repeats; ++i)
+    {
+        const auto t {time_loop(ops_per_call, body, min_time)};
+        ns.push_back(t.ns_per_op);
+        cycles_per_op.push_back(t.cycles_per_op);
+        ops += t.ops;
+    }
+
+    timing t;
+    t.ops = ops;
+    t.ns_per_op = median(ns);
+    t.ops_per_sec = t.ns_per_op > 0 ? 1e9 / t.ns_per_op : 0;
+    t.cycles_per_op = median(cycles_per_op);
+    t.ns_mad = median_absolute_deviation(ns);
+    t.repeats = repeats;
+
+    return t;
+}
+
+inline void print_header(std::ostream& os = std::cout)
+{
+    os << std::left << std::setw(36) << "file" << std::setw(12) << "op" << std::setw(14) << "type"
+       << std::right << std::setw(10) << "vectors" << std::setw(12) << "ns/op" << std::setw(14) << "Mops/s"
+       << std::setw(12) << "cycles/op" << '\n';
+}
+
+inline void print_row(const std::string& file, const std::string& op, const char* type, const std::size_t vectors, const timing& t, std::ostream& os = std::cout)
+{
+    os << std::left << std::setw(36) << file << std::setw(12) << op << std::setw(14) << type
+       << std::right << std::setw(10) << vectors
+       << std::fixed << std::setprecision(2)
+       << std::setw(12) << t.ns_per_op << std::setw(14) << t.ops_per_sec / 1e6 << std::setw(12) << t.cycles_per_op
+       << std::defaultfloat << '\n';
+}
+
+} // namespace bench
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_BENCH_HPP
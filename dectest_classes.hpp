@@ -0,0 +1,283 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_CLASSES_HPP
+#define BOOST_DECIMAL_DECTEST_CLASSES_HPP
+
+// The class of the operands of a test case, read from their decTest strings, as in ddClass.decTest.
+//
+// The latency report and bench_dectest group the cases by the classes of their operands, e.g. "subnormal x normal",
+// and for two finite non-zero operands by how far apart their adjusted exponents are compared to the precision:
+// within it the library aligns the coefficients, beyond it the smaller operand only takes part in the rounding.
+// The groups show which kinds of input are slow, whatever their share of a file
+
+#include "dectest_tokenizer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+enum class operand_class
+{
+    zero,
+    normal,
+    subnormal,
+    infinite,
+    qnan,
+    snan,
+    encoded,    // #hex, the class depends on the width
+    invalid     // Not a number in the decTest syntax
+};
+
+inline const char* operand_class_name(const operand_class c) noexcept
+{
+    switch (c)
+    {
+        case operand_class::zero:
+            return "zero";
+        case operand_class::normal:
+            return "normal";
+        case operand_class::subnormal:
+            return "subnormal";
+        case operand_class::infinite:
+            return "inf";
+        case operand_class::qnan:
+            return "qNaN";
+        case operand_class::snan:
+            return "sNaN";
+        case operand_class::encoded:
+            return "encoded";
+        default:
+            return "invalid";
+    }
+}
+
+struct operand_info
+{
+    operand_class cls {operand_class::invalid};
+
+    // Exponent of the most significant digit, e.g. 2 for 123 and -3 for 0.00123,
+    // and the number of digits from there on, 3 for both. Only set for normal and subnormal
+    int adjusted_exponent {};
+    int significant_digits {};
+};
+
+// Subnormal means an adjusted exponent below the emin of ctx
+inline operand_info classify_operand(string_view str, const context& ctx) noexcept
+{
+    operand_info info;
+
+    if (!str.empty() && str[0] == '#')
+    {
+        info.cls = operand_class::encoded;
+        return info;
+    }
+
+    if (!str.empty() && (str[0] == '+' || str[0] == '-'))
+    {
+        str = str.substr(1U);
+    }
+
+    if (detail::iequals(str, "inf") || detail::iequals(str, "infinity"))
+    {
+        info.cls = operand_class::infinite;
+        return info;
+    }
+
+    // NaN and sNaN may carry a payload
+    const auto is_digits = [](const string_view digits)
+    {
+        for (const auto c : digits)
+        {
+            if (c < '0' || c > '9')
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (str.size() >= 3U && detail::iequals(str.substr(0U, 3U), "nan") && is_digits(str.substr(3U)))
+    {
+        info.cls = operand_class::qnan;
+        return info;
+    }
+
+    if (str.size() >= 4U && detail::iequals(str.substr(0U, 4U), "snan") && is_digits(str.substr(4U)))
+    {
+        info.cls = operand_class::snan;
+        return info;
+    }
+
+    // Coefficient with an optional point, then an optional exponent
+    std::size_t pos {};
+    std::size_t digits {};
+    std::size_t significant {};
+    std::size_t fraction {};
+    bool point {};
+    for (; pos < str.size(); ++pos)
+    {
+        const auto c {str[pos]};
+        if (c == '.' && !point)
+        {
+            point = true;
+        }
+        else if (c >= '0' && c <= '9')
+        {
+            ++digits;
+            if (significant > 0U || c != '0')
+            {
+                ++significant;
+            }
+            if (point)
+            {
+                ++fraction;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    int exponent {};
+    if (digits == 0U || (pos < str.size() && ((str[pos] != 'e' && str[pos] != 'E') || !detail::parse_int(str.substr(pos + 1U), exponent))))
+    {
+        return info;
+    }
+
+    if (significant == 0U)
+    {
+        info.cls = operand_class::zero;
+        return info;
+    }
+
+    info.adjusted_exponent = exponent - static_cast<int>(fraction) + static_cast<int>(significant) - 1;
+    info.significant_digits = static_cast<int>(significant);
+    info.cls = info.adjusted_exponent < ctx.min_exponent ? operand_class::subnormal : operand_class::normal;
+    return info;
+}
+
+// e.g. "normal x subnormal" or "normal x normal, gap > p"
+inline std::string case_class(const test_case& tc)
+{
+    std::string label;
+    operand_info infos[3];
+
+    for (std::size_t i {}; i < tc.operand_count; ++i)
+    {
+        infos[i] = classify_operand(tc.operands[i], tc.ctx);
+        if (i > 0U)
+        {
+            label += " x ";
+        }
+        label += operand_class_name(infos[i].cls);
+    }
+
+    const auto finite = [](const operand_info& info)
+    {
+        return info.cls == operand_class::normal || info.cls == operand_class::subnormal;
+    };
+
+    if (tc.operand_count == 2U && finite(infos[0]) && finite(infos[1]))
+    {
+        const auto gap {std::abs(infos[0].adjusted_exponent - infos[1].adjusted_exponent)};
+        label += gap == 0 ? ", gap 0" : gap <= tc.ctx.precision ? ", gap <= p" : ", gap > p";
+    }
+
+    return label;
+}
+
+namespace detail {
+
+struct format_limits
+{
+    int width;
+    int digits;
+    int emin;
+    int emax;
+};
+
+// The IEEE format of width bits, nullptr for other widths
+inline const format_limits* format_of(const int width) noexcept
+{
+    static constexpr format_limits formats[] {{32, 7, -95, 96}, {64, 16, -383, 384}, {128, 34, -6143, 6144}};
+
+    for (const auto& f : formats)
+    {
+        if (f.width == width)
+        {
+            return &f;
+        }
+    }
+
+    return nullptr;
+}
+
+} // namespace detail
+
+// Whether the result of tc, read into the IEEE format of width bits, is the result of the library in that format:
+// the case has at least the digits of the format, its operands are exactly representable in it, and nothing is subnormal.
+// The files of the functions (exp, ln, ...) run the same operands at many precisions and exponent ranges,
+// and only those cases are a reference for the library at a given width.
+//
+// A result of more digits than the format is rounded a second time when it is read. That is exact for the ops
+// whose result needs no rounding, e.g. samequantum or tointegral, but under the half_* modes a rounded result can
+// end up one ULP away from the correctly rounded one: 1.2349 is 1.235 at 4 digits and 1.24 at 3, but 1.23 rounded once.
+// An exact check of a rounded result takes the cases of result_rounded_to_width instead
+inline bool result_fits_width(const test_case& tc, const int width) noexcept
+{
+    const auto f {detail::format_of(width)};
+
+    constexpr std::uint32_t out_of_range {condition::overflow | condition::underflow | condition::subnormal | condition::clamped};
+    if (f == nullptr || tc.ctx.precision < f->digits || (tc.conditions & out_of_range) != 0U)
+    {
+        return false;
+    }
+
+    // The result is rounded to the format when it is read, an operand would change the case
+    const auto fits = [&](const string_view str, const bool exact)
+    {
+        const auto info {classify_operand(str, tc.ctx)};
+        switch (info.cls)
+        {
+            case operand_class::zero:
+            case operand_class::infinite:
+            case operand_class::qnan:
+            case operand_class::snan:
+                return true;
+            case operand_class::normal:
+                return (!exact || info.significant_digits <= f->digits) && info.adjusted_exponent >= f->emin && info.adjusted_exponent <= f->emax;
+            default:
+                return false;
+        }
+    };
+
+    for (std::size_t i {}; i < tc.operand_count; ++i)
+    {
+        if (!fits(tc.operands[i], true))
+        {
+            return false;
+        }
+    }
+
+    return fits(tc.result, false);
+}
+
+// result_fits_width at the precision of the format only, where the result of the file is the correctly rounded one
+inline bool result_rounded_to_width(const test_case& tc, const int width) noexcept
+{
+    const auto f {detail::format_of(width)};
+    return f != nullptr && tc.ctx.precision == f->digits && result_fits_width(tc, width);
+}
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_CLASSES_HPP
@@ -0,0 +1,90 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Checks a benchmark run against a stored baseline
+//
+// Usage: dectest_compare [--threshold PERCENT] [--sigmas N] <baseline> <current>
+//
+// Both files are written by bench_dectest with BOOST_DECIMAL_DECTEST_BASELINE, see dectest_baseline.hpp.
+// Returns non-zero when an op of current is slower than in baseline by more than PERCENT (5 by default)
+// and by more than N (3 by default) standard deviations of the repeats, or when a file can not be read
+
+#include "dectest_baseline.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace boost::decimal::dectest;
+
+namespace {
+
+bool parse_number(const char* str, double& value)
+{
+    char* end {};
+    value = std::strtod(str, &end);
+    return *str != '\0' && *end == '\0' && value >= 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bench::comparison_options options;
+    std::string paths[2];
+    int path_count {};
+
+    for (int i {1}; i < argc; ++i)
+    {
+        const bool has_value {i + 1 < argc};
+        if (std::strcmp(argv[i], "--threshold") == 0 && has_value)
+        {
+            if (!parse_number(argv[++i], options.threshold_percent))
+            {
+                std::cerr << "Invalid threshold: " << argv[i] << std::endl;
+                return 1;
+            }
+        }
+        else if (std::strcmp(argv[i], "--sigmas") == 0 && has_value)
+        {
+            if (!parse_number(argv[++i], options.sigmas))
+            {
+                std::cerr << "Invalid sigmas: " << argv[i] << std::endl;
+                return 1;
+            }
+        }
+        else if (path_count < 2 && argv[i][0] != '-')
+        {
+            paths[path_count++] = argv[i];
+        }
+        else
+        {
+            path_count = 0;
+            break;
+        }
+    }
+
+    if (path_count != 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " [--threshold PERCENT] [--sigmas N] <baseline> <current>" << std::endl;
+        return 1;
+    }
+
+    bench::baseline stored;
+    bench::baseline current;
+    for (int i {}; i < 2; ++i)
+    {
+        if (!bench::read_baseline(paths[i], i == 0 ? stored : current))
+        {
+            std::cerr << "Failed to read baseline: " << paths[i] << std::endl;
+            return 1;
+        }
+    }
+
+    const auto regressions {bench::compare_baselines(stored, current, options)};
+
+    std::cout << '\n' << regressions << " regressions over " << options.threshold_percent << '%' << std::endl;
+
+    return regressions == 0U ? 0 : 1;
+}
@@ -0,0 +1,53 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Compiles decTest files into the binary corpus mapped by test_harness.hpp
+//
+// Usage: dectest_compile <output> <file.decTest>...
+//
+// Each file is stored under the path exactly as given (with '\' replaced by '/'),
+// so run it from this directory with the same relative paths the tests use, e.g.
+//
+//   dectest_compile dectest.corpus dectest/*.decTest dectest0/*.decTest archive/dectest/*.decTest
+
+#include "dectest_corpus.hpp"
+#include <iostream>
+#include <string>
+#include <algorithm>
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <output> <file.decTest>..." << std::endl;
+        return 1;
+    }
+
+    boost::decimal::dectest::corpus_builder builder;
+
+    for (int i {2}; i < argc; ++i)
+    {
+        const std::string path {argv[i]};
+        std::string key {path};
+        std::replace(key.begin(), key.end(), '\\', '/');
+
+        if (!builder.add_file(key, path))
+        {
+            std::cerr << "Failed to open file: " << path << std::endl;
+            return 1;
+        }
+    }
+
+    const std::string output {argv[1]};
+    if (!builder.write(output))
+    {
+        std::cerr << "Failed to write corpus: " << output << std::endl;
+        return 1;
+    }
+
+    std::cout << "Compiled " << (argc - 2) << " files, " << builder.group_count() << " (file, op) groups and "
+              << builder.record_count() << " test cases into " << output << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,745 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_CORPUS_HPP
+#define BOOST_DECIMAL_DECTEST_CORPUS_HPP
+
+// Binary, indexed representation of the decTest vectors.
+//
+// dectest_compile.cpp turns the text files into a single corpus file once per build.
+// The harness then maps that file and walks the fixed size records directly, so a test run
+// does no line parsing and no per test case allocation.
+//
+// Layout (native byte order, all sections 8 byte aligned):
+//
+//   corpus_header
+//   corpus_group[group_count]     one entry per (file, op), sorted as written, with the size and mtime of the file
+//   corpus_record[record_count]   records of a group are contiguous and keep file order
+//   char[string_bytes]            deduplicated string pool referenced by corpus_string
+
+#include "dectest_tokenizer.hpp"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(_WIN32)
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+namespace detail {
+
+struct corpus_string
+{
+    std::uint32_t offset;
+    std::uint32_t size;
+};
+
+struct corpus_header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t group_count;
+    std::uint32_t record_count;
+    std::uint64_t groups_offset;
+    std::uint64_t records_offset;
+    std::uint64_t strings_offset;
+    std::uint64_t string_bytes;
+};
+
+// Size and modification time of a source file, both 0 when the text did not come from a file
+struct file_stamp
+{
+    std::uint64_t size;
+    std::int64_t mtime;
+};
+
+struct corpus_group
+{
+    corpus_string file;
+    corpus_string op;
+    std::uint32_t first_record;
+    std::uint32_t record_count;
+    file_stamp source;
+};
+
+struct corpus_record
+{
+    corpus_string id;
+    corpus_string op;
+    corpus_string operands[3];
+    corpus_string result;
+    std::int32_t precision;
+    std::int32_t max_exponent;
+    std::int32_t min_exponent;
+    std::uint32_t conditions;
+    std::uint32_t line;
+    std::uint8_t operand_count;
+    std::uint8_t round;
+    std::uint8_t flags;
+    std::uint8_t clamp_and_extended;
+};
+
+constexpr char corpus_magic[8] {'D', 'E', 'C', 'T', 'E', 'S', 'T', '\0'};
+constexpr std::uint32_t corpus_version {2U};
+constexpr std::uint32_t corpus_byte_order {0x01020304U};
+
+inline std::uint64_t align8(std::uint64_t value) noexcept
+{
+    return (value + 7U) & ~static_cast<std::uint64_t>(7U);
+}
+
+inline string_view view(const char* strings, corpus_string str) noexcept
+{
+    return string_view(strings + str.offset, str.size);
+}
+
+inline bool stamp_of(const std::string& path, file_stamp& stamp) noexcept
+{
+    #if defined(_WIN32)
+
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!::GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &data))
+    {
+        return false;
+    }
+
+    stamp.size = (static_cast<std::uint64_t>(data.nFileSizeHigh) << 32U) | data.nFileSizeLow;
+    stamp.mtime = static_cast<std::int64_t>((static_cast<std::uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32U) | data.ftLastWriteTime.dwLowDateTime);
+    return true;
+
+    #else
+
+    struct stat st {};
+    if (::stat(path.c_str(), &st) != 0)
+    {
+        return false;
+    }
+
+    stamp.size = static_cast<std::uint64_t>(st.st_size);
+    stamp.mtime = static_cast<std::int64_t>(st.st_mtime);
+    return true;
+
+    #endif
+}
+
+} // namespace detail
+
+// Collects the test cases of any number of decTest files and serializes them as a corpus
+class corpus_builder
+{
+public:
+    // Parses the text of one decTest file and stores its test cases under key.
+    // stamp is that of the file the text was read from, see corpus::is_current
+    void add_text(string_view key, string_view text, const detail::file_stamp stamp = {})
+    {
+        const auto file {intern(key)};
+        stamps_[file.offset] = stamp;
+
+        tokenizer tok {text};
+        record r;
+        while (tok.next_test_case(r))
+        {
+            add_case(file, r.tc);
+        }
+    }
+
+    // Reads path from disk and stores its test cases under key
+    bool add_file(const std::string& key, const std::string& path)
+    {
+        std::ifstream in(path.c_str(), std::ios::binary);
+        if (!in.is_open())
+        {
+            return false;
+        }
+
+        detail::file_stamp stamp {};
+        const std::string text {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+        if (!detail::stamp_of(path, stamp))
+        {
+            return false;
+        }
+
+        add_text(key, text, stamp);
+        return true;
+    }
+
+    std::size_t record_count() const noexcept
+    {
+        std::size_t count {};
+        for (const auto& group : groups_)
+        {
+            count += group.records.size();
+        }
+        return count;
+    }
+
+    std::size_t group_count() const noexcept { return groups_.size(); }
+
+    std::string serialize() const
+    {
+        detail::corpus_header header {};
+        std::memcpy(header.magic, detail::corpus_magic, sizeof(header.magic));
+        header.version = detail::corpus_version;
+        header.byte_order = detail::corpus_byte_order;
+        header.group_count = static_cast<std::uint32_t>(groups_.size());
+        header.record_count = static_cast<std::uint32_t>(record_count());
+        header.groups_offset = detail::align8(sizeof(header));
+        header.records_offset = detail::align8(header.groups_offset + groups_.size() * sizeof(detail::corpus_group));
+        header.strings_offset = detail::align8(header.records_offset + header.record_count * sizeof(detail::corpus_record));
+        header.string_bytes = strings_.size();
+
+        std::string out(static_cast<std::size_t>(header.strings_offset + header.string_bytes), '\0');
+        std::memcpy(&out[0], &header, sizeof(header));
+
+        std::uint32_t first_record {};
+        auto group_pos {static_cast<std::size_t>(header.groups_offset)};
+        auto record_pos {static_cast<std::size_t>(header.records_offset)};
+        for (const auto& group : groups_)
+        {
+            const detail::corpus_group entry {group.file, group.op, first_record, static_cast<std::uint32_t>(group.records.size()), stamps_.at(group.file.offset)};
+            std::memcpy(&out[group_pos], &entry, sizeof(entry));
+            group_pos += sizeof(entry);
+
+            for (const auto& record : group.records)
+            {
+                std::memcpy(&out[record_pos], &record, sizeof(record));
+                record_pos += sizeof(record);
+            }
+
+            first_record += entry.record_count;
+        }
+
+        if (!strings_.empty())
+        {
+            std::memcpy(&out[static_cast<std::size_t>(header.strings_offset)], strings_.data(), strings_.size());
+        }
+
+        return out;
+    }
+
+    bool write(const std::string& path) const
+    {
+        std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+        {
+            return false;
+        }
+
+        const auto bytes {serialize()};
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        return static_cast<bool>(out);
+    }
+
+private:
+    struct pending_group
+    {
+        detail::corpus_string file;
+        detail::corpus_string op;
+        std::vector<detail::corpus_record> records;
+    };
+
+    detail::corpus_string intern(string_view str)
+    {
+        std::string key(str.data(), str.size());
+        const auto it {interned_.find(key)};
+        if (it != interned_.end())
+        {
+            return it->second;
+        }
+
+        const detail::corpus_string entry {static_cast<std::uint32_t>(strings_.size()), static_cast<std::uint32_t>(str.size())};
+        strings_.append(str.data(), str.size());
+        interned_.emplace(std::move(key), entry);
+        return entry;
+    }
+
+    void add_case(detail::corpus_string file, const test_case& tc)
+    {
+        detail::corpus_record record {};
+        record.id = intern(tc.id);
+        record.op = intern(tc.op);
+        for (std::size_t i {}; i < tc.operand_count; ++i)
+        {
+            record.operands[i] = intern(tc.operands[i]);
+        }
+        record.result = intern(tc.result);
+        record.precision = tc.ctx.precision;
+        record.max_exponent = tc.ctx.max_exponent;
+        record.min_exponent = tc.ctx.min_exponent;
+        record.conditions = tc.conditions;
+        record.line = tc.line;
+        record.operand_count = static_cast<std::uint8_t>(tc.operand_count);
+        record.round = static_cast<std::uint8_t>(tc.ctx.round);
+        record.flags = tc.flags;
+        record.clamp_and_extended = static_cast<std::uint8_t>((tc.ctx.clamp ? 1U : 0U) | (tc.ctx.extended ? 2U : 0U));
+
+        // Records are grouped by (file, op) so that the harness can find its range with one lookup
+        for (auto& existing : groups_)
+        {
+            if (existing.file.offset == file.offset && existing.op.offset == record.op.offset && existing.op.size == record.op.size)
+            {
+                existing.records.push_back(record);
+                return;
+            }
+        }
+
+        groups_.push_back(pending_group {file, record.op, {record}});
+    }
+
+    std::string strings_;
+    std::unordered_map<std::string, detail::corpus_string> interned_;
+    std::unordered_map<std::uint32_t, detail::file_stamp> stamps_;
+    std::vector<pending_group> groups_;
+};
+
+// View of one record of a mapped corpus
+class corpus_case
+{
+public:
+    corpus_case(const detail::corpus_record* record, const char* strings) noexcept : record_ {record}, strings_ {strings} {}
+
+    string_view id() const noexcept { return detail::view(strings_, record_->id); }
+    string_view op() const noexcept { return detail::view(strings_, record_->op); }
+    string_view operand(std::size_t i) const noexcept { return detail::view(strings_, record_->operands[i]); }
+    std::size_t operand_count() const noexcept { return record_->operand_count; }
+    string_view result() const noexcept { return detail::view(strings_, record_->result); }
+    int precision() const noexcept { return record_->precision; }
+    rounding round() const noexcept { return static_cast<rounding>(record_->round); }
+    std::uint32_t conditions() const noexcept { return record_->conditions; }
+    std::uint8_t flags() const noexcept { return record_->flags; }
+    std::uint32_t line() const noexcept { return record_->line; }
+
+    test_case to_test_case() const noexcept
+    {
+        test_case tc;
+        tc.id = id();
+        tc.op = op();
+        tc.operand_count = operand_count();
+        for (std::size_t i {}; i < tc.operand_count; ++i)
+        {
+            tc.operands[i] = operand(i);
+        }
+        tc.result = result();
+        tc.conditions = conditions();
+        tc.flags = flags();
+        tc.line = line();
+        tc.ctx.precision = record_->precision;
+        tc.ctx.max_exponent = record_->max_exponent;
+        tc.ctx.min_exponent = record_->min_exponent;
+        tc.ctx.round = round();
+        tc.ctx.clamp = (record_->clamp_and_extended & 1U) != 0U;
+        tc.ctx.extended = (record_->clamp_and_extended & 2U) != 0U;
+        return tc;
+    }
+
+private:
+    const detail::corpus_record* record_;
+    const char* strings_;
+};
+
+class corpus_range
+{
+public:
+    class iterator
+    {
+    public:
+        iterator(const detail::corpus_record* record, const char* strings) noexcept : record_ {record}, strings_ {strings} {}
+
+        corpus_case operator*() const noexcept { return corpus_case(record_, strings_); }
+        iterator& operator++() noexcept { ++record_; return *this; }
+        bool operator==(const iterator& other) const noexcept { return record_ == other.record_; }
+        bool operator!=(const iterator& other) const noexcept { return record_ != other.record_; }
+
+    private:
+        const detail::corpus_record* record_;
+        const char* strings_;
+    };
+
+    corpus_range() noexcept = default;
+    corpus_range(const detail::corpus_record* first, std::size_t count, const char* strings) noexcept
+        : first_ {first}, count_ {count}, strings_ {strings} {}
+
+    iterator begin() const noexcept { return iterator(first_, strings_); }
+    iterator end() const noexcept { return iterator(first_ + count_, strings_); }
+    std::size_t size() const noexcept { return count_; }
+    bool empty() const noexcept { return count_ == 0U; }
+
+private:
+    const detail::corpus_record* first_ {nullptr};
+    std::size_t count_ {};
+    const char* strings_ {nullptr};
+};
+
+// Read-only memory map of a corpus file
+class corpus
+{
+public:
+    corpus() noexcept = default;
+    corpus(const corpus&) = delete;
+    corpus& operator=(const corpus&) = delete;
+    ~corpus() { close(); }
+
+    bool open(const std::string& path)
+    {
+        close();
+
+        if (!map(path))
+        {
+            return false;
+        }
+
+        if (!validate())
+        {
+            close();
+            return false;
+        }
+
+        return true;
+    }
+
+    // Uses an in-memory image, e.g. the result of corpus_builder::serialize
+    bool open_buffer(std::string image)
+    {
+        close();
+
+        buffer_ = std::move(image);
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+
+        if (!validate())
+        {
+            close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void close() noexcept
+    {
+        unmap();
+        buffer_.clear();
+        data_ = nullptr;
+        size_ = 0U;
+        header_ = nullptr;
+    }
+
+    bool is_open() const noexcept { return header_ != nullptr; }
+
+    std::size_t record_count() const noexcept { return header_ == nullptr ? 0U : header_->record_count; }
+
+    // Returns the records of op in file, in file order, or an empty range
+    corpus_range find(string_view file, string_view op) const noexcept
+    {
+        if (header_ == nullptr)
+        {
+            return {};
+        }
+
+        for (std::uint32_t i {}; i < header_->group_count; ++i)
+        {
+            const auto& group {groups_[i]};
+            if (detail::view(strings_, group.op) == op && detail::view(strings_, group.file) == file)
+            {
+                return corpus_range(records_ + group.first_record, group.record_count, strings_);
+            }
+        }
+
+        return {};
+    }
+
+    // Returns every record of file, or an empty range.
+    // The builder writes the groups of a file back to back, so the records are contiguous,
+    // grouped by op in the order the ops first appear and in file order within each op
+    corpus_range find(string_view file) const noexcept
+    {
+        if (header_ == nullptr)
+        {
+            return {};
+        }
+
+        std::uint32_t i {};
+        while (i < header_->group_count && detail::view(strings_, groups_[i].file) != file)
+        {
+            ++i;
+        }
+
+        if (i == header_->group_count)
+        {
+            return {};
+        }
+
+        const auto first {groups_[i].first_record};
+        auto last {first};
+        for (; i < header_->group_count && detail::view(strings_, groups_[i].file) == file; ++i)
+        {
+            if (groups_[i].first_record != last)
+            {
+                // Not written by corpus_builder, let the caller fall back to the text file
+                return {};
+            }
+
+            last += groups_[i].record_count;
+        }
+
+        return corpus_range(records_ + first, last - first, strings_);
+    }
+
+    // Whether the records of file were compiled from the current contents of path, by the size and mtime of path
+    // when the corpus was built. An edited file is then read as text until the corpus is compiled again.
+    // True when path can not be found (the corpus is all there is) or the records did not come from a file
+    bool is_current(string_view file, const std::string& path) const noexcept
+    {
+        detail::file_stamp stamp {};
+        if (header_ == nullptr || path.empty() || !detail::stamp_of(path, stamp))
+        {
+            return true;
+        }
+
+        for (std::uint32_t i {}; i < header_->group_count; ++i)
+        {
+            const auto& group {groups_[i]};
+            if (detail::view(strings_, group.file) == file)
+            {
+                return (group.source.size == 0U && group.source.mtime == 0) ||
+                       (group.source.size == stamp.size && group.source.mtime == stamp.mtime);
+            }
+        }
+
+        return true;
+    }
+
+private:
+    bool validate() noexcept
+    {
+        if (data_ == nullptr || size_ < sizeof(detail::corpus_header))
+        {
+            return false;
+        }
+
+        const auto* header {reinterpret_cast<const detail::corpus_header*>(data_)};
+        if (std::memcmp(header->magic, detail::corpus_magic, sizeof(header->magic)) != 0 ||
+            header->version != detail::corpus_version ||
+            header->byte_order != detail::corpus_byte_order)
+        {
+            return false;
+        }
+
+        const std::uint64_t file_size {size_};
+        if (header->groups_offset + static_cast<std::uint64_t>(header->group_count) * sizeof(detail::corpus_group) > file_size ||
+            header->records_offset + static_cast<std::uint64_t>(header->record_count) * sizeof(detail::corpus_record) > file_size ||
+            header->strings_offset + header->string_bytes > file_size)
+        {
+            return false;
+        }
+
+        groups_ = reinterpret_cast<const detail::corpus_group*>(data_ + header->groups_offset);
+        records_ = reinterpret_cast<const detail::corpus_record*>(data_ + header->records_offset);
+        strings_ = data_ + header->strings_offset;
+
+        // Check every reference once here so that lookups never need to
+        const auto string_ok = [header](detail::corpus_string str) noexcept
+        {
+            return static_cast<std::uint64_t>(str.offset) + str.size <= header->string_bytes;
+        };
+
+        for (std::uint32_t i {}; i < header->group_count; ++i)
+        {
+            const auto& group {groups_[i]};
+            if (!string_ok(group.file) || !string_ok(group.op) ||
+                static_cast<std::uint64_t>(group.first_record) + group.record_count > header->record_count)
+            {
+                return false;
+            }
+        }
+
+        for (std::uint32_t i {}; i < header->record_count; ++i)
+        {
+            const auto& record {records_[i]};
+            if (!string_ok(record.id) || !string_ok(record.op) || !string_ok(record.result) || record.operand_count > 3U)
+            {
+                return false;
+            }
+
+            for (std::size_t j {}; j < record.operand_count; ++j)
+            {
+                if (!string_ok(record.operands[j]))
+                {
+                    return false;
+                }
+            }
+        }
+
+        header_ = header;
+        return true;
+    }
+
+    #if defined(_WIN32)
+
+    bool map(const std::string& path) noexcept
+    {
+        file_ = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(file_, &file_size) || file_size.QuadPart == 0)
+        {
+            unmap();
+            return false;
+        }
+
+        mapping_ = ::CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ == nullptr)
+        {
+            unmap();
+            return false;
+        }
+
+        data_ = static_cast<const char*>(::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (data_ == nullptr)
+        {
+            unmap();
+            return false;
+        }
+
+        size_ = static_cast<std::size_t>(file_size.QuadPart);
+        mapped_ = true;
+        return true;
+    }
+
+    void unmap() noexcept
+    {
+        if (mapped_)
+        {
+            ::UnmapViewOfFile(data_);
+            mapped_ = false;
+        }
+        if (mapping_ != nullptr)
+        {
+            ::CloseHandle(mapping_);
+            mapping_ = nullptr;
+        }
+        if (file_ != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(file_);
+            file_ = INVALID_HANDLE_VALUE;
+        }
+    }
+
+    HANDLE file_ {INVALID_HANDLE_VALUE};
+    HANDLE mapping_ {nullptr};
+
+    #else
+
+    bool map(const std::string& path) noexcept
+    {
+        const int fd {::open(path.c_str(), O_RDONLY)};
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        void* address {::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0)};
+        ::close(fd);
+
+        if (address == MAP_FAILED)
+        {
+            return false;
+        }
+
+        data_ = static_cast<const char*>(address);
+        size_ = static_cast<std::size_t>(st.st_size);
+        mapped_ = true;
+        return true;
+    }
+
+    void unmap() noexcept
+    {
+        if (mapped_)
+        {
+            ::munmap(const_cast<char*>(data_), size_);
+            mapped_ = false;
+        }
+    }
+
+    #endif
+
+    std::string buffer_;
+    const char* data_ {nullptr};
+    std::size_t size_ {};
+    bool mapped_ {false};
+
+    const detail::corpus_header* header_ {nullptr};
+    const detail::corpus_group* groups_ {nullptr};
+    const detail::corpus_record* records_ {nullptr};
+    const char* strings_ {nullptr};
+};
+
+// The corpus used by the harness: $BOOST_DECIMAL_DECTEST_CORPUS if set, otherwise dectest.corpus
+// in the working directory (where the CMake build writes it).
+// If neither is available, or a file changed since the corpus was compiled, the harness parses the text files as before
+namespace detail {
+
+inline bool open_default_corpus(corpus& c)
+{
+    const char* env_path {environment("BOOST_DECIMAL_DECTEST_CORPUS")};
+
+    if (env_path != nullptr && c.open(env_path))
+    {
+        return true;
+    }
+
+    return c.open("dectest.corpus");
+}
+
+} // namespace detail
+
+inline const corpus& default_corpus()
+{
+    static corpus instance;
+    static const bool opened {detail::open_default_corpus(instance)};
+    static_cast<void>(opened);
+
+    return instance;
+}
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_CORPUS_HPP
@@ -0,0 +1,417 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Runs the decTest files of every op from a single executable
+//
+// Usage: dectest_driver [--op OP]... [--file FILE]... [--width 32|64|128] [--id ID | --id FIRST..LAST]
+//                       [--shard I/N] [--results FILE] [--list]
+//
+// Without options every file of dectest_registry.hpp is run, as the test_*.cpp executables do.
+// The options narrow that down, e.g. to re-run one failing vector:
+//
+//   dectest_driver --op add --width 64 --id ddadd011..ddadd020 --file dectest/ddAdd.decTest
+//
+// A --file that is not in the registry is run with the handlers of all the selected ops,
+// following its rounding: directives.
+//
+// --shard I/N runs the cases of shard I of N and --results FILE appends what every file found to FILE,
+// so that N processes, each with its own I, can run the whole registry and dectest_merge can report on all of them:
+//
+//   dectest_driver --shard 0/4 --results shard0.txt
+//   ...
+//   dectest_merge shard0.txt shard1.txt shard2.txt shard3.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_registry.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace boost::decimal;
+
+namespace {
+
+// The handlers of each op, see dectest_registry.hpp. Only the driver instantiates all of them
+struct op_entry
+{
+    const char* op;
+    void (*add)(dectest::dectest_runner&);
+};
+
+const op_entry op_registry[] {
+    {"abs", dectest::register_abs<>},
+    {"add", dectest::register_add<>},
+    {"apply", dectest::register_apply<>},
+    {"compare", dectest::register_compare<>},
+    {"comparesig", dectest::register_comparesig<>},
+    {"comparetotal", dectest::register_comparetotal<>},
+    {"divide", dectest::register_divide<>},
+    {"exp", dectest::register_exp<>},
+    {"fma", dectest::register_fma<>},
+    {"ln", dectest::register_ln<>},
+    {"log10", dectest::register_log10<>},
+    {"logb", dectest::register_logb<>},
+    {"max", dectest::register_max<>},
+    {"min", dectest::register_min<>},
+    {"minus", dectest::register_minus<>},
+    {"multiply", dectest::register_multiply<>},
+    {"nextminus", dectest::register_nextminus<>},
+    {"nextplus", dectest::register_nextplus<>},
+    {"nexttoward", dectest::register_nexttoward<>},
+    {"plus", dectest::register_plus<>},
+    {"power", dectest::register_power<>},
+    {"quantize", dectest::register_quantize<>},
+    {"remainder", dectest::register_remainder<>},
+    {"rescale", dectest::register_rescale<>},
+    {"samequantum", dectest::register_samequantum<>},
+    {"scaleb", dectest::register_scaleb<>},
+    {"squareroot", dectest::register_squareroot<>},
+    {"subtract", dectest::register_subtract<>},
+    {"toSci", dectest::register_toSci<>},
+    {"tointegral", dectest::register_tointegral<>},
+    {"tointegralx", dectest::register_tointegralx<>},
+};
+
+struct options
+{
+    std::vector<std::string> ops;
+    std::vector<std::string> files;
+    int width {};
+    std::string first_id;
+    std::string last_id;
+    dectest::shard_spec shard;
+    bool has_shard {};
+    std::string results;
+    bool has_results {};
+    bool list {};
+};
+
+// Whether value is one of values, an empty list selects everything
+bool contains(const std::vector<std::string>& values, const std::string& value)
+{
+    return values.empty() || std::find(values.begin(), values.end(), value) != values.end();
+}
+
+const op_entry* find_op(const std::string& op)
+{
+    for (const auto& entry : op_registry)
+    {
+        if (op == entry.op)
+        {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+bool in_registry(const std::string& path)
+{
+    for (const auto& entry : dectest::registered_files)
+    {
+        if (path == entry.path)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Ids are a prefix and a number, e.g. ddadd011. Ids with the same prefix are ordered by number,
+// so ddadd9..ddadd11 is what it looks like; otherwise they are compared as text without case
+int compare_ids(const dectest::string_view lhs, const dectest::string_view rhs)
+{
+    const auto split = [](const dectest::string_view id)
+    {
+        auto digits {id.size()};
+        while (digits > 0U && id[digits - 1U] >= '0' && id[digits - 1U] <= '9')
+        {
+            --digits;
+        }
+
+        return digits;
+    };
+
+    const auto lhs_split {split(lhs)};
+    const auto rhs_split {split(rhs)};
+    const auto lhs_prefix {lhs.substr(0, lhs_split)};
+    const auto rhs_prefix {rhs.substr(0, rhs_split)};
+
+    if (dectest::detail::iequals(lhs_prefix, rhs_prefix))
+    {
+        auto lhs_number {lhs.substr(lhs_split)};
+        auto rhs_number {rhs.substr(rhs_split)};
+
+        while (lhs_number.size() > 1U && lhs_number[0] == '0')
+        {
+            lhs_number = lhs_number.substr(1);
+        }
+        while (rhs_number.size() > 1U && rhs_number[0] == '0')
+        {
+            rhs_number = rhs_number.substr(1);
+        }
+
+        if (lhs_number.size() != rhs_number.size())
+        {
+            return lhs_number.size() < rhs_number.size() ? -1 : 1;
+        }
+
+        return lhs_number.compare(rhs_number);
+    }
+
+    for (std::size_t i {}; i < lhs.size() && i < rhs.size(); ++i)
+    {
+        const auto l {std::tolower(static_cast<unsigned char>(lhs[i]))};
+        const auto r {std::tolower(static_cast<unsigned char>(rhs[i]))};
+        if (l != r)
+        {
+            return l < r ? -1 : 1;
+        }
+    }
+
+    return lhs.size() == rhs.size() ? 0 : lhs.size() < rhs.size() ? -1 : 1;
+}
+
+void print_usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " [--op OP]... [--file FILE]... [--width 32|64|128] [--id ID | --id FIRST..LAST]"
+              << " [--shard I/N] [--results FILE] [--list]" << std::endl;
+}
+
+// Takes both --name value and --name=value. Returns false for unknown options and missing values
+bool parse_options(const int argc, char** argv, options& opts)
+{
+    for (int i {1}; i < argc; ++i)
+    {
+        std::string name {argv[i]};
+        std::string value;
+
+        const auto equals {name.find('=')};
+        if (equals != std::string::npos)
+        {
+            value = name.substr(equals + 1U);
+            name.resize(equals);
+        }
+        else if (name != "--list")
+        {
+            if (i + 1 >= argc)
+            {
+                std::cerr << "Missing value of " << name << std::endl;
+                return false;
+            }
+
+            value = argv[++i];
+        }
+
+        if (name == "--op")
+        {
+            if (find_op(value) == nullptr)
+            {
+                std::cerr << "No handler for op: " << value << std::endl;
+                return false;
+            }
+
+            opts.ops.push_back(value);
+        }
+        else if (name == "--file")
+        {
+            opts.files.push_back(value);
+        }
+        else if (name == "--width")
+        {
+            if (!dectest::detail::parse_int(dectest::string_view(value), opts.width) ||
+                (opts.width != 32 && opts.width != 64 && opts.width != 128))
+            {
+                std::cerr << "Invalid width: " << value << std::endl;
+                return false;
+            }
+        }
+        else if (name == "--id")
+        {
+            const auto range {value.find("..")};
+            opts.first_id = value.substr(0, range);
+            opts.last_id = range == std::string::npos ? opts.first_id : value.substr(range + 2U);
+        }
+        else if (name == "--shard")
+        {
+            if (!dectest::parse_shard(dectest::string_view(value), opts.shard))
+            {
+                std::cerr << "Invalid shard: " << value << std::endl;
+                return false;
+            }
+
+            opts.has_shard = true;
+        }
+        else if (name == "--results")
+        {
+            opts.results = value;
+            opts.has_results = true;
+        }
+        else if (name == "--list")
+        {
+            opts.list = true;
+        }
+        else
+        {
+            std::cerr << "Unknown option: " << name << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    options opts;
+    if (!parse_options(argc, argv, opts))
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    // The files to run in registry order, then the ones given that it does not have
+    std::vector<std::string> paths;
+    for (const auto& entry : dectest::registered_files)
+    {
+        if (contains(opts.ops, entry.op) && contains(opts.files, entry.path) &&
+            std::find(paths.begin(), paths.end(), entry.path) == paths.end())
+        {
+            paths.emplace_back(entry.path);
+        }
+    }
+
+    for (const auto& path : opts.files)
+    {
+        if (!in_registry(path) && std::find(paths.begin(), paths.end(), path) == paths.end())
+        {
+            paths.push_back(path);
+        }
+    }
+
+    if (opts.list)
+    {
+        for (const auto& path : paths)
+        {
+            std::cout << path << ':';
+            for (const auto& entry : dectest::registered_files)
+            {
+                if (path == entry.path && contains(opts.ops, entry.op))
+                {
+                    std::cout << ' ' << entry.op;
+                }
+            }
+            std::cout << '\n';
+        }
+
+        return 0;
+    }
+
+    // Each run of the driver starts a new results file, the runners append to it
+    if (opts.has_results && !std::ofstream(opts.results.c_str(), std::ios::trunc).is_open())
+    {
+        std::cerr << "Failed to open results file: " << opts.results << std::endl;
+        return 1;
+    }
+
+    std::size_t selected {};
+    const auto keep = [&](const dectest::test_case& tc)
+    {
+        if (opts.width != 0 && dectest::detail::width_of(tc.ctx.precision) != opts.width)
+        {
+            return false;
+        }
+
+        if (!opts.first_id.empty() &&
+            (compare_ids(tc.id, dectest::string_view(opts.first_id)) < 0 || compare_ids(tc.id, dectest::string_view(opts.last_id)) > 0))
+        {
+            return false;
+        }
+
+        ++selected;
+        return true;
+    };
+
+    const auto filtered {opts.width != 0 || !opts.first_id.empty()};
+
+    std::cerr << std::setprecision(std::numeric_limits<decimal128_t>::max_digits10);
+
+    for (const auto& path : paths)
+    {
+        // One runner per file with the handlers of all its selected ops, so the file is read once
+        bool allow_rounding_changes {!in_registry(path)};
+        bool registry_selects {};
+        std::vector<std::string> ops;
+        for (const auto& entry : dectest::registered_files)
+        {
+            if (path == entry.path && contains(opts.ops, entry.op))
+            {
+                ops.emplace_back(entry.op);
+                allow_rounding_changes = entry.allow_rounding_changes;
+                registry_selects = registry_selects || entry.select != nullptr;
+            }
+        }
+
+        if (ops.empty())
+        {
+            for (const auto& entry : op_registry)
+            {
+                if (contains(opts.ops, entry.op))
+                {
+                    ops.emplace_back(entry.op);
+                }
+            }
+        }
+
+        boost::decimal::fesetround(rounding_mode::fe_dec_default);
+
+        dectest::dectest_runner runner {allow_rounding_changes};
+        for (const auto& op : ops)
+        {
+            find_op(op)->add(runner);
+        }
+
+        // The cases that the registry selects for each op of the file, of those the ones the options ask for
+        if (registry_selects)
+        {
+            runner.restrict_to([&](const dectest::test_case& tc) { return dectest::registered_select(path, tc); });
+        }
+
+        if (filtered)
+        {
+            runner.select(keep);
+        }
+
+        if (opts.has_shard)
+        {
+            runner.shard(opts.shard);
+        }
+
+        if (opts.has_results)
+        {
+            runner.record_results(opts.results);
+        }
+
+        std::cerr << "\n" << path << std::endl;
+        runner.run(path);
+    }
+
+    if (paths.empty() || (filtered && selected == 0U))
+    {
+        std::cerr << "No test case matches the options" << std::endl;
+        return 1;
+    }
+
+    std::cerr << "\nRan " << paths.size() << " files" << (filtered ? ", " + std::to_string(selected) + " selected test cases" : std::string()) << std::endl;
+
+    return boost::report_errors();
+}
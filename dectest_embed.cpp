@@ -0,0 +1,275 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Generates the constexpr tables of dectest_embedded.hpp, one header per decTest file
+//
+// Usage: dectest_embed <output directory> <file.decTest>...
+//
+// Like dectest_compile each file is registered under the path exactly as given (with '\' replaced by '/'),
+// so run it from this directory with the relative paths the tests use, e.g.
+//
+//   dectest_embed embedded dectest0/add0.decTest dectest0/multiply0.decTest
+//
+// writes embedded/dectest0_add0.hpp and embedded/dectest0_multiply0.hpp.
+// The headers include "dectest_embedded.hpp", so a test that includes them needs this directory on its include path
+
+#include <boost/decimal.hpp>
+#include "dectest_tokenizer.hpp"
+#include "dectest_embedded.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+using namespace boost::decimal;
+using namespace boost::decimal::dectest;
+
+namespace {
+
+// dectest0/add0.decTest -> dectest0_add0
+std::string identifier(const std::string& path)
+{
+    auto stem {path.substr(0, path.find_last_of('.'))};
+    for (auto& c : stem)
+    {
+        if (!std::isalnum(static_cast<unsigned char>(c)))
+        {
+            c = '_';
+        }
+    }
+
+    if (stem.empty() || std::isdigit(static_cast<unsigned char>(stem.front())))
+    {
+        stem.insert(0, "_");
+    }
+
+    return stem;
+}
+
+std::string literal(const string_view str)
+{
+    std::string out {"\""};
+    for (const auto c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            out += '\\';
+            out += c;
+        }
+        else if (std::isprint(static_cast<unsigned char>(c)))
+        {
+            out += c;
+        }
+        else
+        {
+            // Octal so that a following digit can not extend the escape
+            std::ostringstream escape;
+            escape << '\\' << std::oct << std::setw(3) << std::setfill('0') << static_cast<unsigned>(static_cast<unsigned char>(c));
+            out += escape.str();
+        }
+    }
+    out += '"';
+    return out;
+}
+
+embedded_bid bid_of(const decimal32_t value) noexcept { return embedded_bid {0U, to_bid(value)}; }
+embedded_bid bid_of(const decimal64_t value) noexcept { return embedded_bid {0U, to_bid(value)}; }
+
+embedded_bid bid_of(const decimal128_t value) noexcept
+{
+    const auto bits {to_bid(value)};
+    return embedded_bid {bits.high, bits.low};
+}
+
+template <typename T>
+bool encode(const string_view str, embedded_bid& bits)
+{
+    T value;
+    const auto last {str.data() + str.size()};
+    const auto r {from_chars(str.data(), last, value)};
+    if (str.empty() || r.ec != std::errc() || r.ptr != last)
+    {
+        return false;
+    }
+
+    bits = bid_of(value);
+    return true;
+}
+
+// Stores the bits of every operand and the result that is a valid decimal of type T
+template <typename T>
+std::uint8_t encode_case(const test_case& tc, embedded_bid (&operand_bits)[3], embedded_bid& result_bits)
+{
+    std::uint8_t has_bits {};
+    if ((tc.flags & case_flags::hash_marker) != 0U)
+    {
+        return has_bits;
+    }
+
+    for (std::size_t i {}; i < tc.operand_count; ++i)
+    {
+        if (encode<T>(tc.operands[i], operand_bits[i]))
+        {
+            has_bits = static_cast<std::uint8_t>(has_bits | (1U << i));
+        }
+    }
+
+    if (encode<T>(tc.result, result_bits))
+    {
+        has_bits = static_cast<std::uint8_t>(has_bits | embedded_bits::result);
+    }
+
+    return has_bits;
+}
+
+void write_bid(std::ostream& os, const embedded_bid bits)
+{
+    os << "{UINT64_C(0x" << bits.high << "), UINT64_C(0x" << bits.low << ")}";
+}
+
+void write_case(std::ostream& os, const test_case& tc)
+{
+    embedded_bid operand_bits[3] {};
+    embedded_bid result_bits {};
+    const auto width {static_cast<std::uint8_t>(detail::width_of(tc.ctx.precision))};
+    std::uint8_t has_bits {};
+
+    switch (width)
+    {
+        case 32:
+            has_bits = encode_case<decimal32_t>(tc, operand_bits, result_bits);
+            break;
+        case 64:
+            has_bits = encode_case<decimal64_t>(tc, operand_bits, result_bits);
+            break;
+        default:
+            has_bits = encode_case<decimal128_t>(tc, operand_bits, result_bits);
+            break;
+    }
+
+    os << "    {" << literal(tc.id) << ", " << literal(tc.op) << ", {";
+    for (std::size_t i {}; i < 3U; ++i)
+    {
+        os << (i == 0U ? "" : ", ") << literal(i < tc.operand_count ? tc.operands[i] : string_view());
+    }
+
+    os << "}, " << literal(tc.result) << ", "
+       << std::dec << tc.ctx.precision << ", " << tc.ctx.max_exponent << ", " << tc.ctx.min_exponent << ", "
+       << tc.conditions << "U, " << tc.line << "U, "
+       << tc.operand_count << "U, "
+       << static_cast<unsigned>(tc.ctx.round) << "U, "
+       << static_cast<unsigned>(tc.flags) << "U, "
+       << ((tc.ctx.clamp ? 1U : 0U) | (tc.ctx.extended ? 2U : 0U)) << "U, "
+       << static_cast<unsigned>(width) << "U, "
+       << static_cast<unsigned>(has_bits) << "U,\n     {";
+
+    os << std::hex;
+    for (std::size_t i {}; i < 3U; ++i)
+    {
+        os << (i == 0U ? "" : ", ");
+        write_bid(os, operand_bits[i]);
+    }
+    os << "}, ";
+    write_bid(os, result_bits);
+    os << std::dec << "},\n";
+}
+
+bool generate(const std::string& key, const std::string& path, const std::string& output_dir, std::size_t& total)
+{
+    std::ifstream in(path.c_str(), std::ios::binary);
+    if (!in.is_open())
+    {
+        std::cerr << "Failed to open file: " << path << std::endl;
+        return false;
+    }
+
+    const std::string text {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+
+    const auto name {identifier(key)};
+    std::string guard {"BOOST_DECIMAL_DECTEST_EMBEDDED_" + name};
+    std::transform(guard.begin(), guard.end(), guard.begin(), [](const char c) { return static_cast<char>(std::toupper(static_cast<unsigned char>(c))); });
+
+    std::ostringstream cases;
+    std::size_t count {};
+
+    tokenizer tok {text};
+    record r;
+    while (tok.next_test_case(r))
+    {
+        write_case(cases, r.tc);
+        ++count;
+    }
+
+    if (count == 0U)
+    {
+        std::cerr << "No test cases in: " << path << std::endl;
+        return false;
+    }
+
+    const auto header_path {output_dir + '/' + name + ".hpp"};
+    std::ofstream out(header_path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        std::cerr << "Failed to write header: " << header_path << std::endl;
+        return false;
+    }
+
+    out << "// Generated by dectest_embed from " << key << ", do not edit\n\n"
+        << "#ifndef " << guard << "_HPP\n"
+        << "#define " << guard << "_HPP\n\n"
+        << "#include \"dectest_embedded.hpp\"\n\n"
+        << "namespace boost {\nnamespace decimal {\nnamespace dectest {\nnamespace embedded {\n\n"
+        << "constexpr embedded_case " << name << "_cases[] {\n"
+        << cases.str()
+        << "};\n\n"
+        << "constexpr embedded_file " << name << " {" << literal(key) << ", " << name << "_cases, " << count << "U};\n\n"
+        << "namespace {\n\nconst embedded_registrar " << name << "_registrar {" << name << "};\n\n} // namespace\n\n"
+        << "} // namespace embedded\n} // namespace dectest\n} // namespace decimal\n} // namespace boost\n\n"
+        << "#endif // " << guard << "_HPP\n";
+
+    if (!out)
+    {
+        std::cerr << "Failed to write header: " << header_path << std::endl;
+        return false;
+    }
+
+    total += count;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <output directory> <file.decTest>..." << std::endl;
+        return 1;
+    }
+
+    const std::string output_dir {argv[1]};
+    std::size_t total {};
+
+    for (int i {2}; i < argc; ++i)
+    {
+        const std::string path {argv[i]};
+        std::string key {path};
+        std::replace(key.begin(), key.end(), '\\', '/');
+
+        if (!generate(key, path, output_dir, total))
+        {
+            return 1;
+        }
+    }
+
+    std::cout << "Generated " << (argc - 2) << " headers with " << total << " test cases in " << output_dir << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_EMBEDDED_HPP
+#define BOOST_DECIMAL_DECTEST_EMBEDDED_HPP
+
+// Test vectors compiled into the test binary.
+//
+// dectest_embed.cpp turns each decTest file into a header of constexpr tables: the strings of every test case
+// together with the BID encoding of its operands and result in the width the harness uses for its precision.
+// Including a generated header registers its file, and the harness then serves that file from the tables
+// without opening anything. The handlers decode the stored bits of each case (see embedded_value)
+// instead of parsing its operand and result strings.
+//
+// Headers are named after the path of their file, e.g. dectest0/add0.decTest becomes dectest0_add0.hpp
+
+#include <boost/decimal.hpp>
+#include "dectest_tokenizer.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+// Bits of a BID encoded value, decimal32_t and decimal64_t only use low
+struct embedded_bid
+{
+    std::uint64_t high;
+    std::uint64_t low;
+};
+
+namespace embedded_bits {
+
+enum : std::uint8_t
+{
+    // Bit i for operands[i]
+    result = 1U << 3
+};
+
+} // namespace embedded_bits
+
+struct embedded_case
+{
+    const char* id;
+    const char* op;
+    const char* operands[3];
+    const char* result;
+    int precision;
+    int max_exponent;
+    int min_exponent;
+    std::uint32_t conditions;
+    std::uint32_t line;
+    std::uint8_t operand_count;
+    std::uint8_t round;
+    std::uint8_t flags;
+    std::uint8_t clamp_and_extended;
+
+    // 32, 64 or 128, the same choice of type by precision as the harness makes
+    std::uint8_t width;
+
+    // Which of operand_bits and result_bits hold a value, see embedded_bits.
+    // Strings that are not valid decimals (e.g. '#' operands or '?' results) have none
+    std::uint8_t has_bits;
+
+    embedded_bid operand_bits[3];
+    embedded_bid result_bits;
+};
+
+struct embedded_file
+{
+    const char* path;
+    const embedded_case* cases;
+    std::size_t count;
+};
+
+inline test_case to_test_case(const embedded_case& c) noexcept
+{
+    test_case tc;
+    tc.id = c.id;
+    tc.op = c.op;
+    tc.operand_count = c.operand_count;
+    for (std::size_t i {}; i < tc.operand_count; ++i)
+    {
+        tc.operands[i] = c.operands[i];
+    }
+    tc.result = c.result;
+    tc.conditions = c.conditions;
+    tc.flags = c.flags;
+    tc.line = c.line;
+    tc.ctx.precision = c.precision;
+    tc.ctx.max_exponent = c.max_exponent;
+    tc.ctx.min_exponent = c.min_exponent;
+    tc.ctx.round = static_cast<rounding>(c.round);
+    tc.ctx.clamp = (c.clamp_and_extended & 1U) != 0U;
+    tc.ctx.extended = (c.clamp_and_extended & 2U) != 0U;
+    tc.embedded = &c;
+    return tc;
+}
+
+// Decodes the bits stored for a value of type T.
+// from_bid is constexpr from C++20, which is what the compile time checks of test_embedded.cpp rely on
+template <typename T>
+BOOST_DECIMAL_CXX20_CONSTEXPR T from_embedded_bits(embedded_bid bits) noexcept;
+
+template <>
+BOOST_DECIMAL_CXX20_CONSTEXPR decimal32_t from_embedded_bits<decimal32_t>(const embedded_bid bits) noexcept
+{
+    return from_bid<decimal32_t>(static_cast<std::uint32_t>(bits.low));
+}
+
+template <>
+BOOST_DECIMAL_CXX20_CONSTEXPR decimal64_t from_embedded_bits<decimal64_t>(const embedded_bid bits) noexcept
+{
+    return from_bid<decimal64_t>(bits.low);
+}
+
+template <>
+BOOST_DECIMAL_CXX20_CONSTEXPR decimal128_t from_embedded_bits<decimal128_t>(const embedded_bid bits) noexcept
+{
+    return from_bid<decimal128_t>(int128::uint128_t {bits.high, bits.low});
+}
+
+// The width of the stored bits that T decodes, 0 for types without an encoding here (e.g. decimal_fast32_t)
+template <typename T>
+struct embedded_width : std::integral_constant<int, 0> {};
+
+template <>
+struct embedded_width<decimal32_t> : std::integral_constant<int, 32> {};
+
+template <>
+struct embedded_width<decimal64_t> : std::integral_constant<int, 64> {};
+
+template <>
+struct embedded_width<decimal128_t> : std::integral_constant<int, 128> {};
+
+// Sets value to operands[i] of c, or to its result for i == 3, from the stored bits instead of the string.
+// Returns false when c has no bits for it in the width of T, the caller then parses the string
+template <typename T, typename std::enable_if<embedded_width<T>::value != 0, bool>::type = true>
+BOOST_DECIMAL_CXX20_CONSTEXPR bool embedded_value(const embedded_case& c, const std::size_t i, T& value) noexcept
+{
+    const auto bit {i < 3U ? static_cast<unsigned>(1U << i) : static_cast<unsigned>(embedded_bits::result)};
+    if (c.width != embedded_width<T>::value || (c.has_bits & bit) == 0U)
+    {
+        return false;
+    }
+
+    value = from_embedded_bits<T>(i < 3U ? c.operand_bits[i] : c.result_bits);
+    return true;
+}
+
+template <typename T, typename std::enable_if<embedded_width<T>::value == 0, bool>::type = true>
+constexpr bool embedded_value(const embedded_case&, const std::size_t, T&) noexcept
+{
+    return false;
+}
+
+// Intrusive list of the generated files included in this binary, built during static initialization
+class embedded_registrar
+{
+public:
+    explicit embedded_registrar(const embedded_file& file) noexcept : file_ {&file}, next_ {head()}
+    {
+        head() = this;
+    }
+
+    embedded_registrar(const embedded_registrar&) = delete;
+    embedded_registrar& operator=(const embedded_registrar&) = delete;
+
+    // Returns the tables of path, or nullptr if no generated header for it was included
+    static const embedded_file* find(const string_view path) noexcept
+    {
+        for (auto r {head()}; r != nullptr; r = r->next_)
+        {
+            if (path == r->file_->path)
+            {
+                return r->file_;
+            }
+        }
+
+        return nullptr;
+    }
+
+private:
+    static const embedded_registrar*& head() noexcept
+    {
+        static const embedded_registrar* first {nullptr};
+        return first;
+    }
+
+    const embedded_file* file_;
+    const embedded_registrar* next_;
+};
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_EMBEDDED_HPP
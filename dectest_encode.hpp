@@ -0,0 +1,63 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_ENCODE_HPP
+#define BOOST_DECIMAL_DECTEST_ENCODE_HPP
+
+// Conversions between the decimal types and the DPD encodings of the decTest Encode files,
+// shared by test_encode.cpp and bench_encode.cpp
+
+#include <boost/decimal.hpp>
+#include "dectest_tokenizer.hpp"
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+inline encoded_operand dpd_of(const decimal32_t value) { return {0U, to_dpd(value), 8U}; }
+inline encoded_operand dpd_of(const decimal64_t value) { return {0U, to_dpd(value), 16U}; }
+
+inline encoded_operand dpd_of(const decimal128_t value)
+{
+    const auto bits {to_dpd(value)};
+    return {bits.high, bits.low, 32U};
+}
+
+// bits.digits is not checked, the caller picks T from it
+template <typename T>
+T from_encoded(const encoded_operand& bits);
+
+template <>
+inline decimal32_t from_encoded<decimal32_t>(const encoded_operand& bits) { return from_dpd<decimal32_t>(static_cast<std::uint32_t>(bits.low)); }
+
+template <>
+inline decimal64_t from_encoded<decimal64_t>(const encoded_operand& bits) { return from_dpd<decimal64_t>(bits.low); }
+
+template <>
+inline decimal128_t from_encoded<decimal128_t>(const encoded_operand& bits) { return from_dpd<decimal128_t>(boost::int128::uint128_t {bits.high, bits.low}); }
+
+// In the form of the decTest files, e.g. #A2300000000003D0
+inline std::ostream& operator<<(std::ostream& os, const encoded_operand& bits)
+{
+    os << '#' << std::hex << std::setfill('0');
+    if (bits.digits == 32U)
+    {
+        os << std::setw(16) << bits.high << std::setw(16) << bits.low;
+    }
+    else
+    {
+        os << std::setw(static_cast<int>(bits.digits)) << bits.low;
+    }
+
+    return os << std::dec << std::setfill(' ');
+}
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_ENCODE_HPP
@@ -0,0 +1,270 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_LATENCY_HPP
+#define BOOST_DECIMAL_DECTEST_LATENCY_HPP
+
+// Per test case latency of the operation under test.
+//
+// When BOOST_DECIMAL_DECTEST_LATENCY=N is set (or dectest_runner::record_latency is called) the one and two
+// argument handlers time every call of the tested function, and dectest_runner::run prints a histogram
+// of the file and its N slowest test ids. Slow ids point at the inputs that take slow paths in the library.
+//
+// A call is timed several times and the fastest is kept, which removes most of the interrupts and cache misses.
+// The unit is time stamp counter ticks where there is one, nanoseconds otherwise.
+// The cases are also grouped by the classes of their operands (see dectest_classes.hpp),
+// with the median latency of each group
+
+#include "dectest_tokenizer.hpp"
+#include "dectest_bench.hpp"
+#include "dectest_classes.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+namespace detail {
+
+#ifdef BOOST_DECIMAL_DECTEST_HAS_RDTSC
+constexpr const char* latency_unit {"ticks"};
+#else
+constexpr const char* latency_unit {"ns"};
+#endif
+
+constexpr int latency_repeats {5};
+
+inline std::uint64_t latency_now() noexcept
+{
+    #ifdef BOOST_DECIMAL_DECTEST_HAS_RDTSC
+    return bench::cycles();
+    #else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    #endif
+}
+
+// Whether timed_call measures on this thread
+inline bool& latency_enabled() noexcept
+{
+    static thread_local bool enabled {};
+    return enabled;
+}
+
+// What the last timed_call on this thread measured, 0 if nothing was
+inline std::uint64_t& last_latency() noexcept
+{
+    static thread_local std::uint64_t latency {};
+    return latency;
+}
+
+// Returns f(args...), timing the call when latency_enabled()
+template <typename Function, typename... Args>
+auto timed_call(Function& f, const Args&... args) -> decltype(f(args...))
+{
+    auto res {f(args...)};
+
+    if (latency_enabled())
+    {
+        auto best {std::numeric_limits<std::uint64_t>::max()};
+        for (int i {}; i < latency_repeats; ++i)
+        {
+            const auto start {latency_now()};
+            bench::do_not_optimize(f(args...));
+            const auto elapsed {latency_now() - start};
+            best = std::min(best, elapsed);
+        }
+
+        // A call shorter than the resolution of the clock still took some time
+        last_latency() = std::max(best, std::uint64_t(1));
+    }
+
+    return res;
+}
+
+// The N of $BOOST_DECIMAL_DECTEST_LATENCY, 0 when it is not set
+inline std::size_t latency_from_environment() noexcept
+{
+    const char* env {environment("BOOST_DECIMAL_DECTEST_LATENCY")};
+
+    int top {};
+    if (env != nullptr && parse_int(string_view(env), top) && top > 0)
+    {
+        return static_cast<std::size_t>(top);
+    }
+
+    return 0U;
+}
+
+} // namespace detail
+
+// Latencies of the cases of one file
+class latency_report
+{
+public:
+    struct entry
+    {
+        std::string id;
+        std::string operation;
+        std::uint64_t latency;
+    };
+
+    // The cases whose operands have the classes of label, see case_class
+    struct class_latency
+    {
+        std::string label;
+        std::size_t count;
+        std::uint64_t median;
+        std::uint64_t max;
+    };
+
+    // Bucket i counts the latencies in [2^i, 2^(i + 1))
+    using histogram_type = std::array<std::size_t, 64>;
+
+    explicit latency_report(const std::size_t top) : top_ {top} {}
+
+    void record(const test_case& tc, const std::uint64_t latency)
+    {
+        std::size_t bucket {};
+        while (bucket + 1U < histogram_.size() && (latency >> (bucket + 1U)) != 0U)
+        {
+            ++bucket;
+        }
+        ++histogram_[bucket];
+
+        // The operands go into the report so that a slow case can be reproduced without the file
+        std::string operation(tc.op.data(), tc.op.size());
+        for (std::size_t i {}; i < tc.operand_count; ++i)
+        {
+            operation += ' ';
+            operation.append(tc.operands[i].data(), tc.operands[i].size());
+        }
+
+        entries_.push_back(entry {std::string(tc.id.data(), tc.id.size()), std::move(operation), latency});
+
+        auto label {case_class(tc)};
+        auto group {std::find_if(classes_.begin(), classes_.end(), [&](const class_group& g) { return g.label == label; })};
+        if (group == classes_.end())
+        {
+            classes_.push_back(class_group {std::move(label), {}});
+            group = classes_.end() - 1;
+        }
+        group->latencies.push_back(latency);
+    }
+
+    std::size_t size() const noexcept { return entries_.size(); }
+
+    const histogram_type& histogram() const noexcept { return histogram_; }
+
+    // The top slowest cases, slowest first, ties in file order
+    std::vector<entry> slowest() const
+    {
+        std::vector<entry> sorted {entries_};
+        std::stable_sort(sorted.begin(), sorted.end(), [](const entry& lhs, const entry& rhs) { return lhs.latency > rhs.latency; });
+
+        if (sorted.size() > top_)
+        {
+            sorted.resize(top_);
+        }
+
+        return sorted;
+    }
+
+    // One entry per group of operand classes, slowest median first
+    std::vector<class_latency> by_class() const
+    {
+        std::vector<class_latency> groups;
+        for (const auto& g : classes_)
+        {
+            auto latencies {g.latencies};
+            const auto middle {latencies.begin() + static_cast<std::ptrdiff_t>(latencies.size() / 2U)};
+            std::nth_element(latencies.begin(), middle, latencies.end());
+
+            groups.push_back(class_latency {g.label, latencies.size(), *middle, *std::max_element(latencies.begin(), latencies.end())});
+        }
+
+        std::stable_sort(groups.begin(), groups.end(), [](const class_latency& lhs, const class_latency& rhs) { return lhs.median > rhs.median; });
+        return groups;
+    }
+
+    void print(const std::string& file_path, std::ostream& os = std::cerr) const
+    {
+        if (entries_.empty())
+        {
+            return;
+        }
+
+        std::size_t first {};
+        while (histogram_[first] == 0U)
+        {
+            ++first;
+        }
+
+        std::size_t last {histogram_.size() - 1U};
+        while (histogram_[last] == 0U)
+        {
+            --last;
+        }
+
+        const auto peak {*std::max_element(histogram_.begin(), histogram_.end())};
+        constexpr std::size_t bar_width {50U};
+
+        os << "\nLatency of " << file_path << " in " << detail::latency_unit << ", fastest of "
+           << detail::latency_repeats << " calls, " << entries_.size() << " cases\n";
+
+        for (auto i {first}; i <= last; ++i)
+        {
+            const auto low {std::uint64_t(1) << i};
+            const auto high {i + 1U < 64U ? (std::uint64_t(1) << (i + 1U)) - 1U : std::numeric_limits<std::uint64_t>::max()};
+
+            os << std::right << std::setw(12) << low << " - " << std::left << std::setw(12) << high
+               << std::right << std::setw(8) << histogram_[i] << "  "
+               << std::string((histogram_[i] * bar_width + peak - 1U) / peak, '#') << '\n';
+        }
+
+        const auto top {slowest()};
+        os << "\nSlowest " << top.size() << ":\n";
+        for (const auto& e : top)
+        {
+            os << std::right << std::setw(12) << e.latency << "  " << std::left << std::setw(16) << e.id << ' ' << e.operation << '\n';
+        }
+
+        os << "\nBy operand class:\n" << std::left << std::setw(40) << "classes" << std::right << std::setw(8) << "cases"
+           << std::setw(12) << "median" << std::setw(12) << "max" << '\n';
+        for (const auto& g : by_class())
+        {
+            os << std::left << std::setw(40) << g.label << std::right << std::setw(8) << g.count
+               << std::setw(12) << g.median << std::setw(12) << g.max << '\n';
+        }
+
+        os << std::right << std::endl;
+    }
+
+private:
+    struct class_group
+    {
+        std::string label;
+        std::vector<std::uint64_t> latencies;
+    };
+
+    std::size_t top_;
+    histogram_type histogram_ {};
+    std::vector<entry> entries_;
+    std::vector<class_group> classes_;
+};
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_LATENCY_HPP
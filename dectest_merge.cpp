@@ -0,0 +1,197 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Combines the results files of the shards of a run into one report
+//
+// Usage: dectest_merge <results>...
+//
+// The results are written by runs with BOOST_DECIMAL_DECTEST_RESULTS or dectest_driver --results,
+// see dectest_shard.hpp. The report has the totals of each file and op, the failed ids,
+// and the number of cases and time of each shard. Returns non-zero when a case failed,
+// when shards are missing or repeated, or when a file can not be read
+
+#include "dectest_shard.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace boost::decimal::dectest;
+
+namespace {
+
+struct shard_totals
+{
+    std::string name;
+    std::string source;
+    std::size_t cases {};
+    std::uint64_t microseconds {};
+};
+
+shard_totals& find_shard(std::vector<shard_totals>& shards, const std::string& name, const std::string& source, bool& repeated)
+{
+    for (auto& s : shards)
+    {
+        if (s.name == name)
+        {
+            repeated = repeated || s.source != source;
+            return s;
+        }
+    }
+
+    shards.push_back(shard_totals {name, source, 0U, 0U});
+    return shards.back();
+}
+
+shard_result& find_total(std::vector<shard_result>& totals, const shard_result& r)
+{
+    for (auto& t : totals)
+    {
+        if (t.file == r.file && t.op == r.op)
+        {
+            return t;
+        }
+    }
+
+    shard_result t;
+    t.file = r.file;
+    t.op = r.op;
+    totals.push_back(std::move(t));
+    return totals.back();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <results>..." << std::endl;
+        return 1;
+    }
+
+    bool ok {true};
+    bool repeated {};
+    std::vector<shard_totals> shards;
+    std::vector<shard_result> totals;
+
+    for (int i {1}; i < argc; ++i)
+    {
+        const std::string source {argv[i]};
+
+        std::vector<shard_result> results;
+        std::vector<std::string> run_shards;
+        if (!read_results(source, results, run_shards))
+        {
+            std::cerr << "Failed to read results: " << source << std::endl;
+            ok = false;
+            continue;
+        }
+
+        // A shard is there once it ran, with or without cases
+        for (const auto& name : run_shards)
+        {
+            static_cast<void>(find_shard(shards, name, source, repeated));
+        }
+
+        for (const auto& r : results)
+        {
+            auto& s {find_shard(shards, r.shard, source, repeated)};
+            s.cases += r.found;
+            s.microseconds += r.microseconds;
+
+            auto& t {find_total(totals, r)};
+            t.found += r.found;
+            t.failed += r.failed;
+            t.invalid += r.invalid;
+            t.skipped += r.skipped;
+            t.microseconds += r.microseconds;
+            t.failed_ids.insert(t.failed_ids.end(), r.failed_ids.begin(), r.failed_ids.end());
+        }
+    }
+
+    if (repeated)
+    {
+        std::cerr << "A shard appears in more than one results file" << std::endl;
+        ok = false;
+    }
+
+    // Every shard of the run has to be there exactly once
+    shard_spec first;
+    if (!shards.empty() && parse_shard(string_view(shards.front().name), first))
+    {
+        for (std::size_t index {}; index < first.count; ++index)
+        {
+            const auto name {shard_name(shard_spec {index, first.count})};
+            if (std::none_of(shards.begin(), shards.end(), [&](const shard_totals& s) { return s.name == name; }))
+            {
+                std::cerr << "Missing shard: " << name << std::endl;
+                ok = false;
+            }
+        }
+
+        for (const auto& s : shards)
+        {
+            shard_spec shard;
+            if (!parse_shard(string_view(s.name), shard) || shard.count != first.count)
+            {
+                std::cerr << "Shard " << s.name << " is not one of " << first.count << std::endl;
+                ok = false;
+            }
+        }
+    }
+
+    std::size_t found {};
+    std::size_t failed {};
+
+    std::cout << std::left << std::setw(40) << "file" << std::setw(14) << "op" << std::right << std::setw(10) << "cases"
+              << std::setw(10) << "failed" << std::setw(10) << "invalid" << std::setw(10) << "skipped" << std::setw(12) << "ms" << '\n';
+
+    for (auto& t : totals)
+    {
+        found += t.found;
+        failed += t.failed;
+
+        std::cout << std::left << std::setw(40) << t.file << std::setw(14) << t.op << std::right << std::setw(10) << t.found
+                  << std::setw(10) << t.failed << std::setw(10) << t.invalid << std::setw(10) << t.skipped
+                  << std::fixed << std::setprecision(1) << std::setw(12) << static_cast<double>(t.microseconds) / 1e3
+                  << std::defaultfloat << '\n';
+    }
+
+    for (auto& t : totals)
+    {
+        std::sort(t.failed_ids.begin(), t.failed_ids.end());
+        for (const auto& id : t.failed_ids)
+        {
+            std::cout << "Failed test: " << id << " (" << t.op << " in " << t.file << ")\n";
+        }
+    }
+
+    // The slowest shard decides when the run ends
+    std::uint64_t slowest {};
+    std::uint64_t total_time {};
+    std::cout << '\n' << std::left << std::setw(12) << "shard" << std::right << std::setw(10) << "cases" << std::setw(12) << "ms" << '\n';
+    for (const auto& s : shards)
+    {
+        slowest = std::max(slowest, s.microseconds);
+        total_time += s.microseconds;
+
+        std::cout << std::left << std::setw(12) << s.name << std::right << std::setw(10) << s.cases
+                  << std::fixed << std::setprecision(1) << std::setw(12) << static_cast<double>(s.microseconds) / 1e3
+                  << std::defaultfloat << '\n';
+    }
+
+    if (total_time > 0U)
+    {
+        const auto mean {static_cast<double>(total_time) / static_cast<double>(shards.size())};
+        std::cout << "Slowest shard: " << std::fixed << std::setprecision(2) << static_cast<double>(slowest) / mean
+                  << " times the mean\n" << std::defaultfloat;
+    }
+
+    std::cout << '\n' << found << " test cases in " << shards.size() << " shards, " << failed << " failed" << std::endl;
+
+    return ok && failed == 0U ? 0 : 1;
+}
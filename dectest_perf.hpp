@@ -0,0 +1,200 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_PERF_HPP
+#define BOOST_DECIMAL_DECTEST_PERF_HPP
+
+// Hardware performance counters around the batches of dectest_runner::run, Linux only.
+//
+// When BOOST_DECIMAL_DECTEST_PERF is set (or dectest_runner::record_perf is called) every batch of one op,
+// rounding mode and precision is counted with perf_event_open: instructions, cycles, branch misses and
+// L1 data cache read misses of this thread in user space. The batch table of each file then shows them per case,
+// e.g. whether dqDivide is bound by mispredicted branches or by the cycles of its 128-bit arithmetic.
+//
+// The counts include constructing the operands from their strings and checking the results,
+// so they compare batches with each other rather than measure the op alone.
+// Counters the kernel or the machine does not allow (see /proc/sys/kernel/perf_event_paranoid)
+// are left out of the table, and elsewhere than on Linux nothing is counted
+
+#if defined(__linux__)
+#  define BOOST_DECIMAL_DECTEST_HAS_PERF_EVENTS
+#endif
+
+#include "dectest_tokenizer.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#ifdef BOOST_DECIMAL_DECTEST_HAS_PERF_EVENTS
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+enum perf_counter : std::size_t
+{
+    perf_instructions,
+    perf_cycles,
+    perf_branch_misses,
+    perf_l1d_misses,
+    perf_counter_count
+};
+
+constexpr const char* perf_counter_names[perf_counter_count] {"instr", "cycles", "br-miss", "L1d-miss"};
+
+// The counts of one measurement, valid[i] is false for a counter that could not be opened
+struct perf_sample
+{
+    std::array<std::uint64_t, perf_counter_count> counts {};
+    std::array<bool, perf_counter_count> valid {};
+
+    perf_sample& operator+=(const perf_sample& other) noexcept
+    {
+        for (std::size_t i {}; i < perf_counter_count; ++i)
+        {
+            counts[i] += other.counts[i];
+            valid[i] = valid[i] || other.valid[i];
+        }
+
+        return *this;
+    }
+};
+
+// The counters of the calling thread. Not copyable, each one owns its file descriptors
+class perf_counters
+{
+public:
+    perf_counters() noexcept
+    {
+        #ifdef BOOST_DECIMAL_DECTEST_HAS_PERF_EVENTS
+
+        const std::uint64_t l1d_read_miss {PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8U) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U)};
+
+        fds_[perf_instructions] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        fds_[perf_cycles] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        fds_[perf_branch_misses] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        fds_[perf_l1d_misses] = open(PERF_TYPE_HW_CACHE, l1d_read_miss);
+
+        #endif
+    }
+
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+    ~perf_counters()
+    {
+        #ifdef BOOST_DECIMAL_DECTEST_HAS_PERF_EVENTS
+        for (const auto fd : fds_)
+        {
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+        }
+        #endif
+    }
+
+    // Whether any of the counters could be opened
+    bool available() const noexcept
+    {
+        for (const auto fd : fds_)
+        {
+            if (fd >= 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void start() noexcept
+    {
+        #ifdef BOOST_DECIMAL_DECTEST_HAS_PERF_EVENTS
+        for (const auto fd : fds_)
+        {
+            if (fd >= 0)
+            {
+                ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+        #endif
+    }
+
+    perf_sample stop() noexcept
+    {
+        perf_sample sample;
+
+        #ifdef BOOST_DECIMAL_DECTEST_HAS_PERF_EVENTS
+        for (const auto fd : fds_)
+        {
+            if (fd >= 0)
+            {
+                ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+
+        for (std::size_t i {}; i < perf_counter_count; ++i)
+        {
+            std::uint64_t count {};
+            if (fds_[i] >= 0 && ::read(fds_[i], &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count)))
+            {
+                sample.counts[i] = count;
+                sample.valid[i] = true;
+            }
+        }
+        #endif
+
+        return sample;
+    }
+
+private:
+    #ifdef BOOST_DECIMAL_DECTEST_HAS_PERF_EVENTS
+
+    static int open(const std::uint32_t type, const std::uint64_t config) noexcept
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        // This thread on any CPU
+        return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0UL));
+    }
+
+    #endif
+
+    std::array<int, perf_counter_count> fds_ {{-1, -1, -1, -1}};
+};
+
+namespace detail {
+
+// Whether $BOOST_DECIMAL_DECTEST_PERF is set
+inline bool perf_from_environment() noexcept
+{
+    const char* env {environment("BOOST_DECIMAL_DECTEST_PERF")};
+
+    return env != nullptr && *env != '\0' && std::strcmp(env, "0") != 0;
+}
+
+} // namespace detail
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_PERF_HPP
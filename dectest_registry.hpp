@@ -0,0 +1,464 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_REGISTRY_HPP
+#define BOOST_DECIMAL_DECTEST_REGISTRY_HPP
+
+// The handlers and files of every op, shared by the test_*.cpp executables and dectest_driver.
+//
+// register_<op>(runner) adds the handlers of op, and registered_files lists the files each op is run on:
+// with the cases that are a reference for the library when it is not all of them, and whether the runner
+// follows the rounding: directives of the file. run_registered runs the files of an op as its test does.
+//
+// The register functions are templates so that a test only instantiates the handlers of the ops it calls,
+// register_add(runner) calls one and register_add<> is its address
+
+#include <boost/decimal.hpp>
+#include "test_harness.hpp"
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+// The cases of a general file whose result is a reference for the width of their precision, see result_fits_width.
+// For the ops whose result needs no rounding at the digits of the width
+inline bool reference_case(const test_case& tc) noexcept
+{
+    return result_fits_width(tc, detail::width_of(tc.ctx.precision));
+}
+
+// reference_case for the ops that round, which are only checked at the precision of a width, see result_rounded_to_width
+inline bool rounded_reference_case(const test_case& tc) noexcept
+{
+    return result_rounded_to_width(tc, detail::width_of(tc.ctx.precision));
+}
+
+// The general quantize files run at several precisions, but whether a quantization fits in the coefficient depends on it,
+// so only the cases at the precision of decimal32_t are a reference for the library
+inline bool decimal32_reference(const test_case& tc) noexcept
+{
+    return tc.ctx.precision == std::numeric_limits<decimal32_t>::digits && result_fits_width(tc, 32);
+}
+
+// The exponents that are not an integer are an invalid operation that the library has no rescale for
+inline bool integer_rescale(const test_case& tc) noexcept
+{
+    int exponent {};
+    return decimal32_reference(tc) && detail::parse_int(tc.operands[1], exponent);
+}
+
+// The second operand of scaleb is a decimal that has to be an integer, scalbn and scalbln take the integer.
+// The cases of other operands are an invalid operation, which the library has no way to give
+inline bool integer_scale(const test_case& tc) noexcept
+{
+    int exponent {};
+    return (tc.conditions & condition::invalid_operation) == 0U && detail::parse_int(tc.operands[1], exponent);
+}
+
+// nexttoward takes the direction as a long double. Where the direction converted there and back keeps its order to
+// the first operand, without reaching or crossing it, nexttoward takes the step of the file.
+// Only finite and infinite operands are parsed, the NaNs (with payloads such as NaN77) and encodings are left out
+template <typename T>
+bool long_double_direction(const test_case& tc)
+{
+    for (std::size_t i {}; i < 2U; ++i)
+    {
+        const auto cls {classify_operand(tc.operands[i], tc.ctx).cls};
+        if (cls == operand_class::qnan || cls == operand_class::snan ||
+            cls == operand_class::encoded || cls == operand_class::invalid)
+        {
+            return false;
+        }
+    }
+
+    const auto x {detail::case_value<T>(tc, 0U)};
+    const auto y {detail::case_value<T>(tc, 1U)};
+    const auto toward {static_cast<T>(static_cast<long double>(y))};
+    return (x < y) == (x < toward) && (y < x) == (toward < x) && (x == y) == (x == toward);
+}
+
+template <typename Runner = dectest_runner>
+void register_abs(Runner& runner)
+{
+    runner.add_one_arg("abs", [](const auto x) { return abs(x); });
+}
+
+template <typename Runner = dectest_runner>
+void register_add(Runner& runner)
+{
+    runner.add_two_arg("add", [](const auto x, const auto y) { return x + y; });
+}
+
+// The clamp file checks the conversion of its operands
+template <typename Runner = dectest_runner>
+void register_apply(Runner& runner)
+{
+    runner.add_one_arg("apply", [](const auto x) { return x; });
+}
+
+template <typename Runner = dectest_runner>
+void register_compare(Runner& runner)
+{
+    runner.add_comparisons("compare");
+}
+
+template <typename Runner = dectest_runner>
+void register_comparesig(Runner& runner)
+{
+    runner.add_comparisons("comparesig");
+}
+
+template <typename Runner = dectest_runner>
+void register_comparetotal(Runner& runner)
+{
+    runner.add_comparetotal("comparetotal");
+}
+
+template <typename Runner = dectest_runner>
+void register_divide(Runner& runner)
+{
+    runner.add_two_arg("divide", [](const auto x, const auto y) { return x / y; });
+}
+
+// The files of exp, ln and log10 repeat their operands at precisions up to hundreds of digits and exponents beyond any width,
+// each width gets all the cases that are a reference for it. They only round half_even, the default of the library
+template <typename Runner = dectest_runner>
+void register_exp(Runner& runner)
+{
+    const auto f = [](const auto x) { return exp(x); };
+    runner.template add_reference<1U>("exp", f, 10U);
+}
+
+// The files of fma round in every decTest mode, the runner sets each that the library has, down as toward zero,
+// and skips up, half_down and 05up
+template <typename Runner = dectest_runner>
+void register_fma(Runner& runner)
+{
+    const auto f = [](const auto x, const auto y, const auto z) { return fma(x, y, z); };
+    runner.template add_typed<decimal32_t, 3U>("fma", f)
+          .template add_typed<decimal64_t, 3U>("fma", f)
+          .template add_typed<decimal128_t, 3U>("fma", f);
+}
+
+template <typename Runner = dectest_runner>
+void register_ln(Runner& runner)
+{
+    const auto f = [](const auto x) { return log(x); };
+    runner.template add_reference<1U>("ln", f, 10U);
+}
+
+template <typename Runner = dectest_runner>
+void register_log10(Runner& runner)
+{
+    const auto f = [](const auto x) { return log10(x); };
+    runner.template add_reference<1U>("log10", f, 10U);
+}
+
+// The logb files are for decimal64_t and decimal128_t only
+template <typename Runner = dectest_runner>
+void register_logb(Runner& runner)
+{
+    const auto f = [](const auto x) { return logb(x); };
+    runner.template add_typed<decimal64_t, 1U>("logb", f)
+          .template add_typed<decimal128_t, 1U>("logb", f);
+}
+
+template <typename Runner = dectest_runner>
+void register_max(Runner& runner)
+{
+    runner.add_two_arg("max", [](const auto x, const auto y) { return fmax(x, y); });
+}
+
+template <typename Runner = dectest_runner>
+void register_min(Runner& runner)
+{
+    runner.add_two_arg("min", [](const auto x, const auto y) { return fmin(x, y); });
+}
+
+template <typename Runner = dectest_runner>
+void register_minus(Runner& runner)
+{
+    runner.add_one_arg("minus", [](const auto x) { return -x; });
+}
+
+template <typename Runner = dectest_runner>
+void register_multiply(Runner& runner)
+{
+    runner.add_two_arg("multiply", [](const auto x, const auto y) { return x * y; });
+}
+
+template <typename Runner = dectest_runner>
+void register_nextminus(Runner& runner)
+{
+    const auto f = [](const auto x) { return nextafter(x, -std::numeric_limits<std::remove_cv_t<decltype(x)>>::infinity()); };
+    runner.template add_typed<decimal64_t, 1U>("nextminus", f)
+          .template add_typed<decimal128_t, 1U>("nextminus", f);
+}
+
+template <typename Runner = dectest_runner>
+void register_nextplus(Runner& runner)
+{
+    const auto f = [](const auto x) { return nextafter(x, std::numeric_limits<std::remove_cv_t<decltype(x)>>::infinity()); };
+    runner.template add_typed<decimal64_t, 1U>("nextplus", f)
+          .template add_typed<decimal128_t, 1U>("nextplus", f);
+}
+
+// nextafter is the step of nexttoward toward a decimal, so it covers every case.
+// test_next also runs nexttoward itself on the cases of long_double_direction
+template <typename Runner = dectest_runner>
+void register_nexttoward(Runner& runner)
+{
+    const auto f = [](const auto x, const auto y) { return nextafter(x, y); };
+    runner.template add_typed<decimal64_t, 2U>("nexttoward", f)
+          .template add_typed<decimal128_t, 2U>("nexttoward", f);
+}
+
+template <typename Runner = dectest_runner>
+void register_plus(Runner& runner)
+{
+    runner.add_one_arg("plus", [](const auto x) { return +x; });
+}
+
+template <typename Runner = dectest_runner>
+void register_power(Runner& runner)
+{
+    runner.add_two_arg("power", [](const auto x, const auto y) { return pow(x, y); }, 10U);
+}
+
+template <typename Runner = dectest_runner>
+void register_quantize(Runner& runner)
+{
+    const auto f = [](const auto x, const auto y) { return quantize(x, y); };
+    runner.template add_quantum<decimal32_t>("quantize", f)
+          .template add_quantum<decimal64_t>("quantize", f)
+          .template add_quantum<decimal128_t>("quantize", f);
+}
+
+template <typename Runner = dectest_runner>
+void register_remainder(Runner& runner)
+{
+    runner.add_two_arg("remainder", [](const auto x, const auto y) { return x % y; });
+}
+
+// rescale is quantize to the exponent given as an integer
+template <typename Runner = dectest_runner>
+void register_rescale(Runner& runner)
+{
+    runner.template add_quantum<decimal32_t>("rescale", [](const auto x, const auto n)
+    {
+        using T = std::remove_cv_t<decltype(x)>;
+        return quantize(x, T {1, static_cast<int>(n)});
+    });
+}
+
+// The files give the result as 0 or 1
+template <typename Runner = dectest_runner>
+void register_samequantum(Runner& runner)
+{
+    const auto f = [](const auto x, const auto y)
+    {
+        using T = std::remove_cv_t<decltype(x)>;
+        return samequantum(x, y) ? T {1} : T {0};
+    };
+
+    runner.template add_typed<decimal32_t, 2U>("samequantum", f)
+          .template add_typed<decimal64_t, 2U>("samequantum", f)
+          .template add_typed<decimal128_t, 2U>("samequantum", f);
+}
+
+template <typename Runner = dectest_runner>
+void register_scaleb(Runner& runner)
+{
+    const auto f = [](const auto x, const auto y) { return scalbn(x, static_cast<int>(y)); };
+    runner.template add_typed<decimal64_t, 2U>("scaleb", f)
+          .template add_typed<decimal128_t, 2U>("scaleb", f);
+}
+
+template <typename Runner = dectest_runner>
+void register_squareroot(Runner& runner)
+{
+    runner.add_one_arg("squareroot", [](const auto x) { return sqrt(x); }, 10000000U);
+}
+
+template <typename Runner = dectest_runner>
+void register_subtract(Runner& runner)
+{
+    runner.add_two_arg("subtract", [](const auto x, const auto y) { return x - y; });
+}
+
+// Effectively a NOOP since the constructors already perform this string manipulation
+template <typename Runner = dectest_runner>
+void register_toSci(Runner& runner)
+{
+    runner.add_one_arg("toSci", [](const auto x) { return x; });
+}
+
+// The rounding of each case is done by the function for its mode, the mode of the library is left alone
+template <typename Runner = dectest_runner>
+void register_tointegral(Runner& runner)
+{
+    runner.template add_to_integral<decimal32_t>("tointegral")
+          .template add_to_integral<decimal64_t>("tointegral")
+          .template add_to_integral<decimal128_t>("tointegral");
+}
+
+template <typename Runner = dectest_runner>
+void register_tointegralx(Runner& runner)
+{
+    runner.template add_to_integral<decimal32_t>("tointegralx")
+          .template add_to_integral<decimal64_t>("tointegralx")
+          .template add_to_integral<decimal128_t>("tointegralx");
+}
+
+// A file that an op is run on
+struct registered_file
+{
+    const char* op;
+    const char* path;
+
+    // The cases that are a reference for the library, nullptr for all of them
+    bool (*select)(const test_case&);
+
+    bool allow_rounding_changes;
+};
+
+constexpr registered_file registered_files[] {
+    {"abs", "dectest0/abs0.decTest", nullptr, false},
+    {"abs", "dectest/abs.decTest", nullptr, false},
+    {"abs", "dectest/ddAbs.decTest", nullptr, false},
+    {"abs", "dectest/dqAbs.decTest", nullptr, false},
+    {"add", "dectest0/add0.decTest", nullptr, false},
+    {"toSci", "dectest0/base0.decTest", nullptr, false},
+    {"toSci", "dectest/base.decTest", nullptr, false},
+    {"apply", "dectest/clamp.decTest", nullptr, false},
+    {"compare", "dectest0/compare0.decTest", nullptr, false},
+    {"compare", "dectest/compare.decTest", nullptr, false},
+    {"compare", "dectest/ddCompare.decTest", nullptr, false},
+    {"compare", "dectest/dqCompare.decTest", nullptr, false},
+    {"comparesig", "dectest/comparesig.decTest", nullptr, false},
+    {"comparesig", "dectest/ddCompareSig.decTest", nullptr, false},
+    {"comparesig", "dectest/dqCompareSig.decTest", nullptr, false},
+    {"comparetotal", "dectest0/comparetotal0.decTest", nullptr, false},
+    {"comparetotal", "dectest/comparetotal.decTest", nullptr, false},
+    {"comparetotal", "dectest/ddCompareTotal.decTest", nullptr, false},
+    {"comparetotal", "dectest/dqCompareTotal.decTest", nullptr, false},
+    {"divide", "dectest0/divide0.decTest", nullptr, false},
+    {"exp", "archive/dectest/exp.decTest", nullptr, false},
+    {"add", "dectest0/inexact0.decTest", nullptr, false},
+    {"divide", "dectest0/inexact0.decTest", nullptr, false},
+    {"multiply", "dectest0/inexact0.decTest", nullptr, false},
+    {"plus", "dectest0/inexact0.decTest", nullptr, false},
+    {"ln", "archive/dectest/ln.decTest", nullptr, false},
+    {"log10", "archive/dectest/log10.decTest", nullptr, false},
+    {"logb", "archive/dectest/ddLogB.decTest", nullptr, false},
+    {"logb", "archive/dectest/dqLogB.decTest", nullptr, false},
+    {"max", "dectest0/max0.decTest", nullptr, false},
+    {"max", "dectest/max.decTest", nullptr, false},
+    {"max", "dectest/ddMax.decTest", nullptr, false},
+    {"max", "dectest/dqMax.decTest", nullptr, false},
+    {"min", "dectest0/min0.decTest", nullptr, false},
+    {"min", "dectest/min.decTest", nullptr, false},
+    {"min", "dectest/ddMin.decTest", nullptr, false},
+    {"min", "dectest/dqMin.decTest", nullptr, false},
+    {"minus", "dectest0/minus0.decTest", nullptr, false},
+    {"minus", "dectest/minus.decTest", nullptr, false},
+    {"multiply", "dectest0/multiply0.decTest", nullptr, false},
+    {"multiply", "dectest/multiply.decTest", nullptr, false},
+    {"nextminus", "archive/dectest/ddNextMinus.decTest", nullptr, false},
+    {"nextminus", "archive/dectest/dqNextMinus.decTest", nullptr, false},
+    {"nextplus", "archive/dectest/ddNextPlus.decTest", nullptr, false},
+    {"nextplus", "archive/dectest/dqNextPlus.decTest", nullptr, false},
+    {"nexttoward", "archive/dectest/ddNextToward.decTest", nullptr, false},
+    {"nexttoward", "archive/dectest/dqNextToward.decTest", nullptr, false},
+    {"plus", "dectest0/plus0.decTest", nullptr, false},
+    {"power", "dectest0/power0.decTest", nullptr, false},
+    {"remainder", "dectest0/remainder0.decTest", nullptr, false},
+    {"samequantum", "archive/dectest/ddSameQuantum.decTest", nullptr, false},
+    {"samequantum", "archive/dectest/dqSameQuantum.decTest", nullptr, false},
+    {"samequantum", "archive/dectest/samequantum.decTest", reference_case, false},
+    {"scaleb", "archive/dectest/ddScaleB.decTest", integer_scale, false},
+    {"scaleb", "archive/dectest/dqScaleB.decTest", integer_scale, false},
+    {"squareroot", "dectest0/squareroot0.decTest", nullptr, false},
+    {"subtract", "dectest0/subtract0.decTest", nullptr, false},
+    {"tointegral", "dectest0/tointegral0.decTest", reference_case, false},
+    {"tointegral", "archive/dectest/tointegral.decTest", reference_case, false},
+    {"tointegralx", "archive/dectest/ddToIntegral.decTest", nullptr, false},
+    {"tointegralx", "archive/dectest/dqToIntegral.decTest", nullptr, false},
+    {"tointegralx", "archive/dectest/tointegralx.decTest", reference_case, false},
+
+    // Requires rounding-mode changes
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    {"add", "dectest/ddAdd.decTest", nullptr, true},
+    {"add", "dectest/dqAdd.decTest", nullptr, true},
+    {"divide", "dectest/ddDivide.decTest", nullptr, true},
+    {"divide", "dectest/dqDivide.decTest", nullptr, true},
+    {"fma", "archive/dectest/fma.decTest", rounded_reference_case, true},
+    {"fma", "archive/dectest/ddFMA.decTest", nullptr, true},
+    {"fma", "archive/dectest/dqFMA.decTest", nullptr, true},
+    {"multiply", "dectest/ddMultiply.decTest", nullptr, true},
+    {"multiply", "dectest/dqMultiply.decTest", nullptr, true},
+    {"quantize", "archive/dectest/ddQuantize.decTest", nullptr, true},
+    {"quantize", "archive/dectest/dqQuantize.decTest", nullptr, true},
+    {"quantize", "archive/dectest/quantize.decTest", decimal32_reference, true},
+    {"remainder", "dectest/ddRemainder.decTest", nullptr, true},
+    {"remainder", "dectest/dqRemainder.decTest", nullptr, true},
+    {"rescale", "archive/dectest/rescale.decTest", integer_rescale, true},
+    {"subtract", "dectest/ddSubtract.decTest", nullptr, true},
+    {"subtract", "dectest/dqSubtract.decTest", nullptr, true},
+    #endif
+};
+
+// The cases of tc.op that the entry of path for it selects, e.g. for a runner of several ops on one file
+inline bool registered_select(const std::string& path, const test_case& tc)
+{
+    for (const auto& file : registered_files)
+    {
+        if (path == file.path && tc.op == string_view(file.op))
+        {
+            return file.select == nullptr || file.select(tc);
+        }
+    }
+
+    return true;
+}
+
+// Runs every registered file of op with the handlers of add, e.g. run_registered("add", register_add<>),
+// each on its own runner that starts in the default rounding mode
+inline void run_registered(const std::string& op, void (*add)(dectest_runner&))
+{
+    std::size_t files {};
+    for (const auto& file : registered_files)
+    {
+        if (op != file.op)
+        {
+            continue;
+        }
+
+        fesetround(rounding_mode::fe_dec_default);
+
+        dectest_runner runner {file.allow_rounding_changes};
+        add(runner);
+        if (file.select != nullptr)
+        {
+            runner.restrict_to(file.select);
+        }
+
+        runner.run(file.path);
+        ++files;
+    }
+
+    fesetround(rounding_mode::fe_dec_default);
+
+    BOOST_TEST_GT(files, 0U);
+}
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_REGISTRY_HPP
@@ -0,0 +1,234 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_SHARD_HPP
+#define BOOST_DECIMAL_DECTEST_SHARD_HPP
+
+// Splitting a run over processes or machines.
+//
+// With BOOST_DECIMAL_DECTEST_SHARD=i/n (or dectest_runner::shard, or --shard=i/n of dectest_driver) a runner only
+// evaluates the cases whose id hashes to shard i of n, counting from 0. The hash does not depend on the file,
+// the order or the machine, so the n shards of a run cover every case exactly once, and since the costly cases
+// are spread like the others the shards take about the same time.
+//
+// With BOOST_DECIMAL_DECTEST_RESULTS=FILE each run appends the totals of each op and the ids of its failed cases
+// to FILE. dectest_merge combines the files of all the shards into one report. The lines are tab separated:
+//
+//   shard   <i/n>
+//   op      <i/n> <file> <op> <found> <failed> <invalid> <skipped> <microseconds>
+//   failed  <i/n> <file> <op> <id>
+//
+// Each run starts with a shard line, so that a shard that got no case of the files still shows up in the report
+
+#include "dectest_tokenizer.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+struct shard_spec
+{
+    std::size_t index {};
+    std::size_t count {1U};
+
+    bool active() const noexcept { return count > 1U; }
+
+    // FNV-1a of the id
+    bool contains(const test_case& tc) const noexcept
+    {
+        std::uint64_t hash {UINT64_C(14695981039346656037)};
+        for (const auto c : tc.id)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= UINT64_C(1099511628211);
+        }
+
+        return hash % count == index;
+    }
+};
+
+// i/n with i < n
+inline bool parse_shard(const string_view str, shard_spec& shard) noexcept
+{
+    const auto slash {str.find('/')};
+    if (slash == string_view::npos)
+    {
+        return false;
+    }
+
+    int index {};
+    int count {};
+    if (!detail::parse_int(str.substr(0, slash), index) || !detail::parse_int(str.substr(slash + 1U), count) ||
+        index < 0 || count < 1 || index >= count)
+    {
+        return false;
+    }
+
+    shard.index = static_cast<std::size_t>(index);
+    shard.count = static_cast<std::size_t>(count);
+    return true;
+}
+
+inline std::string shard_name(const shard_spec& shard)
+{
+    return std::to_string(shard.index) + '/' + std::to_string(shard.count);
+}
+
+namespace detail {
+
+// $BOOST_DECIMAL_DECTEST_SHARD, the whole run when it is not set or not valid
+inline shard_spec shard_from_environment() noexcept
+{
+    shard_spec shard;
+    const char* env {environment("BOOST_DECIMAL_DECTEST_SHARD")};
+    if (env != nullptr && !parse_shard(string_view(env), shard))
+    {
+        shard = shard_spec();
+    }
+
+    return shard;
+}
+
+inline std::string results_from_environment()
+{
+    const char* env {environment("BOOST_DECIMAL_DECTEST_RESULTS")};
+    return env == nullptr ? std::string() : std::string(env);
+}
+
+} // namespace detail
+
+// One line of a results file
+struct shard_result
+{
+    std::string shard;
+    std::string file;
+    std::string op;
+    std::size_t found {};
+    std::size_t failed {};
+    std::size_t invalid {};
+    std::size_t skipped {};
+    std::uint64_t microseconds {};
+    std::vector<std::string> failed_ids;
+};
+
+// The results of one run of shard, which may have none
+inline bool append_results(const std::string& path, const std::string& shard, const std::vector<shard_result>& results)
+{
+    std::ofstream out(path.c_str(), std::ios::app);
+    if (!out.is_open())
+    {
+        return false;
+    }
+
+    out << "shard\t" << shard << '\n';
+
+    for (const auto& r : results)
+    {
+        out << "op\t" << r.shard << '\t' << r.file << '\t' << r.op << '\t' << r.found << '\t' << r.failed << '\t'
+            << r.invalid << '\t' << r.skipped << '\t' << r.microseconds << '\n';
+
+        for (const auto& id : r.failed_ids)
+        {
+            out << "failed\t" << r.shard << '\t' << r.file << '\t' << r.op << '\t' << id << '\n';
+        }
+    }
+
+    return static_cast<bool>(out);
+}
+
+// Appends the results of path to results and the shards of its runs to shards,
+// returns false if it can not be read or has a malformed line
+inline bool read_results(const std::string& path, std::vector<shard_result>& results, std::vector<std::string>& shards)
+{
+    std::ifstream in(path.c_str());
+    if (!in.is_open())
+    {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+
+        std::vector<std::string> fields;
+        std::size_t start {};
+        for (;;)
+        {
+            const auto tab {line.find('\t', start)};
+            fields.push_back(line.substr(start, tab == std::string::npos ? std::string::npos : tab - start));
+            if (tab == std::string::npos)
+            {
+                break;
+            }
+            start = tab + 1U;
+        }
+
+        if (fields[0] == "shard" && fields.size() == 2U)
+        {
+            if (std::find(shards.begin(), shards.end(), fields[1]) == shards.end())
+            {
+                shards.push_back(fields[1]);
+            }
+        }
+        else if (fields[0] == "op" && fields.size() == 9U)
+        {
+            shard_result r;
+            r.shard = fields[1];
+            r.file = fields[2];
+            r.op = fields[3];
+
+            const auto to_number = [](const std::string& str, std::uint64_t& value)
+            {
+                char* end {};
+                value = std::strtoull(str.c_str(), &end, 10);
+                return !str.empty() && *end == '\0';
+            };
+
+            std::uint64_t values[5] {};
+            for (std::size_t i {}; i < 5U; ++i)
+            {
+                if (!to_number(fields[4U + i], values[i]))
+                {
+                    return false;
+                }
+            }
+
+            r.found = static_cast<std::size_t>(values[0]);
+            r.failed = static_cast<std::size_t>(values[1]);
+            r.invalid = static_cast<std::size_t>(values[2]);
+            r.skipped = static_cast<std::size_t>(values[3]);
+            r.microseconds = values[4];
+            results.push_back(std::move(r));
+        }
+        else if (fields[0] == "failed" && fields.size() == 5U && !results.empty() &&
+                 results.back().shard == fields[1] && results.back().file == fields[2] && results.back().op == fields[3])
+        {
+            results.back().failed_ids.push_back(fields[4]);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_SHARD_HPP
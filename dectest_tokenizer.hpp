@@ -0,0 +1,632 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_TOKENIZER_HPP
+#define BOOST_DECIMAL_DECTEST_TOKENIZER_HPP
+
+// Streaming tokenizer for the decTest file format shared by every harness entry point.
+//
+// It walks a view of the whole file and yields one typed record per line.
+// All strings in a record are views into the original text, so tokenizing does not allocate.
+
+#include <boost/core/detail/string_view.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cctype>
+#include <cstdlib>
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+using string_view = boost::core::string_view;
+
+// Precision used by the harness until a file specifies one
+constexpr int default_precision {16};
+
+enum class rounding : std::uint8_t
+{
+    unspecified,
+    ceiling,
+    down,
+    floor,
+    half_down,
+    half_even,
+    half_up,
+    up,
+    zero_five_up,
+    unknown
+};
+
+namespace condition {
+
+enum : std::uint32_t
+{
+    clamped              = UINT32_C(1) << 0,
+    conversion_syntax    = UINT32_C(1) << 1,
+    division_by_zero     = UINT32_C(1) << 2,
+    division_impossible  = UINT32_C(1) << 3,
+    division_undefined   = UINT32_C(1) << 4,
+    inexact              = UINT32_C(1) << 5,
+    insufficient_storage = UINT32_C(1) << 6,
+    invalid_context      = UINT32_C(1) << 7,
+    invalid_operation    = UINT32_C(1) << 8,
+    lost_digits          = UINT32_C(1) << 9,
+    overflow             = UINT32_C(1) << 10,
+    rounded              = UINT32_C(1) << 11,
+    subnormal            = UINT32_C(1) << 12,
+    underflow            = UINT32_C(1) << 13
+};
+
+} // namespace condition
+
+namespace case_flags {
+
+enum : std::uint8_t
+{
+    // The line contains a '#' somewhere.
+    // That is either a decTest encoded operand (#A2300000000003D0), the null operand,
+    // or a test that we have disabled locally, so the arithmetic harnesses skip them.
+    hash_marker = 1U << 0,
+
+    // The line has a '->' but could not be split into id, op, operands and result
+    malformed = 1U << 1
+};
+
+} // namespace case_flags
+
+namespace detail {
+
+// getenv without the deprecation warning of MSVC, for all the BOOST_DECIMAL_DECTEST_* variables
+inline const char* environment(const char* name) noexcept
+{
+    #ifdef _MSC_VER
+    #  pragma warning(push)
+    #  pragma warning(disable : 4996) // getenv is fine here
+    #endif
+
+    const char* env {std::getenv(name)};
+
+    #ifdef _MSC_VER
+    #  pragma warning(pop)
+    #endif
+
+    return env;
+}
+
+inline bool iequals(string_view lhs, string_view rhs) noexcept
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        if (std::tolower(static_cast<unsigned char>(lhs[i])) != std::tolower(static_cast<unsigned char>(rhs[i])))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+inline bool is_space(char c) noexcept
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+
+inline string_view trim(string_view str) noexcept
+{
+    std::size_t first {};
+    std::size_t last {str.size()};
+
+    while (first < last && is_space(str[first]))
+    {
+        ++first;
+    }
+    while (last > first && is_space(str[last - 1U]))
+    {
+        --last;
+    }
+
+    return str.substr(first, last - first);
+}
+
+// Reads the next whitespace separated token starting at pos, removing the quotes of quoted tokens.
+// Returns false once the line is exhausted
+inline bool next_token(string_view line, std::size_t& pos, string_view& token, bool& quoted) noexcept
+{
+    while (pos < line.size() && is_space(line[pos]))
+    {
+        ++pos;
+    }
+
+    if (pos >= line.size())
+    {
+        return false;
+    }
+
+    const char first {line[pos]};
+    if (first == '\'' || first == '"')
+    {
+        // decTest escapes the quote character by doubling it
+        const std::size_t start {pos + 1U};
+        std::size_t i {start};
+        while (i < line.size())
+        {
+            if (line[i] == first)
+            {
+                if (i + 1U < line.size() && line[i + 1U] == first)
+                {
+                    i += 2U;
+                    continue;
+                }
+                break;
+            }
+            ++i;
+        }
+
+        token = line.substr(start, i - start);
+        pos = i < line.size() ? i + 1U : i;
+        quoted = true;
+        return true;
+    }
+
+    const std::size_t start {pos};
+    while (pos < line.size() && !is_space(line[pos]))
+    {
+        ++pos;
+    }
+
+    token = line.substr(start, pos - start);
+    quoted = false;
+    return true;
+}
+
+inline bool parse_int(string_view str, int& value) noexcept
+{
+    std::size_t i {};
+    bool negative {false};
+
+    if (i < str.size() && (str[i] == '-' || str[i] == '+'))
+    {
+        negative = str[i] == '-';
+        ++i;
+    }
+
+    if (i == str.size())
+    {
+        return false;
+    }
+
+    long long result {};
+    for (; i < str.size(); ++i)
+    {
+        if (str[i] < '0' || str[i] > '9')
+        {
+            return false;
+        }
+
+        result = result * 10 + (str[i] - '0');
+        if (result > 2147483647LL)
+        {
+            return false;
+        }
+    }
+
+    value = static_cast<int>(negative ? -result : result);
+    return true;
+}
+
+} // namespace detail
+
+inline rounding parse_rounding(string_view str) noexcept
+{
+    struct entry { const char* name; rounding mode; };
+    static constexpr entry modes[] {
+        {"ceiling", rounding::ceiling},
+        {"down", rounding::down},
+        {"floor", rounding::floor},
+        {"half_down", rounding::half_down},
+        {"half_even", rounding::half_even},
+        {"half_up", rounding::half_up},
+        {"up", rounding::up},
+        {"05up", rounding::zero_five_up}
+    };
+
+    for (const auto& mode : modes)
+    {
+        if (detail::iequals(str, mode.name))
+        {
+            return mode.mode;
+        }
+    }
+
+    return rounding::unknown;
+}
+
+inline const char* rounding_name(rounding mode) noexcept
+{
+    switch (mode)
+    {
+        case rounding::ceiling:
+            return "ceiling";
+        case rounding::down:
+            return "down";
+        case rounding::floor:
+            return "floor";
+        case rounding::half_down:
+            return "half_down";
+        case rounding::half_even:
+            return "half_even";
+        case rounding::half_up:
+            return "half_up";
+        case rounding::up:
+            return "up";
+        case rounding::zero_five_up:
+            return "05up";
+        case rounding::unspecified:
+            return "unspecified";
+        default:
+            return "unknown";
+    }
+}
+
+// Returns 0 for tokens that are not a decTest condition
+inline std::uint32_t parse_condition(string_view str) noexcept
+{
+    struct entry { const char* name; std::uint32_t flag; };
+    static constexpr entry conditions[] {
+        {"Clamped", condition::clamped},
+        {"Conversion_syntax", condition::conversion_syntax},
+        {"Division_by_zero", condition::division_by_zero},
+        {"Division_impossible", condition::division_impossible},
+        {"Division_undefined", condition::division_undefined},
+        {"Inexact", condition::inexact},
+        {"Insufficient_storage", condition::insufficient_storage},
+        {"Invalid_context", condition::invalid_context},
+        {"Invalid_operation", condition::invalid_operation},
+        {"Lost_digits", condition::lost_digits},
+        {"Overflow", condition::overflow},
+        {"Rounded", condition::rounded},
+        {"Subnormal", condition::subnormal},
+        {"Underflow", condition::underflow}
+    };
+
+    for (const auto& c : conditions)
+    {
+        if (detail::iequals(str, c.name))
+        {
+            return c.flag;
+        }
+    }
+
+    return 0U;
+}
+
+// An operand given by its encoding, e.g. #A2300000000003D0.
+// digits is the number of hex digits: 8, 16 or 32 for the 32, 64 and 128 bit formats
+struct encoded_operand
+{
+    std::uint64_t high;
+    std::uint64_t low;
+    std::size_t digits;
+};
+
+// Returns false for tokens that are not '#' followed by 8, 16 or 32 hex digits
+inline bool parse_encoded(string_view str, encoded_operand& value) noexcept
+{
+    if (str.size() < 2U || str[0] != '#')
+    {
+        return false;
+    }
+
+    const auto digits {str.size() - 1U};
+    if (digits != 8U && digits != 16U && digits != 32U)
+    {
+        return false;
+    }
+
+    value = encoded_operand {0U, 0U, digits};
+    for (std::size_t i {1U}; i < str.size(); ++i)
+    {
+        const auto c {str[i]};
+        std::uint64_t nibble {};
+        if (c >= '0' && c <= '9')
+        {
+            nibble = static_cast<std::uint64_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            nibble = static_cast<std::uint64_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            nibble = static_cast<std::uint64_t>(c - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+
+        value.high = (value.high << 4U) | (value.low >> 60U);
+        value.low = (value.low << 4U) | nibble;
+    }
+
+    return true;
+}
+
+// The context in effect at a given line of a decTest file
+struct context
+{
+    int precision {default_precision};
+    int max_exponent {};
+    int min_exponent {};
+    rounding round {rounding::unspecified};
+    bool clamp {false};
+    bool extended {true};
+};
+
+struct embedded_case;
+
+// A single parsed test case.
+// All views refer to the parsed text (or the mapped corpus) and are only valid while it is alive
+struct test_case
+{
+    string_view id;
+    string_view op;
+    string_view operands[3];
+    std::size_t operand_count {};
+    string_view result;
+    std::uint32_t conditions {};
+    std::uint8_t flags {};
+    std::uint32_t line {};
+    context ctx;
+
+    // The table entry of a case compiled into the binary, whose operands and result are already encoded,
+    // see dectest_embedded.hpp. nullptr for cases read from a file or the corpus
+    const embedded_case* embedded {nullptr};
+};
+
+namespace detail {
+
+// The decimal width that the harness uses for a precision, and for T as width_of(std::numeric_limits<T>::digits)
+constexpr int width_of(const int precision) noexcept
+{
+    return precision <= 9 ? 32 : precision <= 16 ? 64 : 128;
+}
+
+// Applies a "keyword: value" line to the context.
+// Returns false if the line is not a directive
+inline bool parse_directive(string_view line, context& ctx, string_view& keyword, string_view& value) noexcept
+{
+    const auto colon {line.find(':')};
+    if (colon == string_view::npos || colon == 0U)
+    {
+        return false;
+    }
+
+    keyword = trim(line.substr(0, colon));
+    for (const char c : keyword)
+    {
+        if (!std::isalnum(static_cast<unsigned char>(c)))
+        {
+            return false;
+        }
+    }
+
+    value = trim(line.substr(colon + 1U));
+
+    // Directives can carry a trailing comment
+    const auto comment {value.find("--")};
+    if (comment != string_view::npos)
+    {
+        value = trim(value.substr(0, comment));
+    }
+
+    int number {};
+    if (iequals(keyword, "precision"))
+    {
+        if (parse_int(value, number))
+        {
+            ctx.precision = number;
+        }
+    }
+    else if (iequals(keyword, "rounding"))
+    {
+        ctx.round = parse_rounding(value);
+    }
+    else if (iequals(keyword, "maxexponent"))
+    {
+        if (parse_int(value, number))
+        {
+            ctx.max_exponent = number;
+        }
+    }
+    else if (iequals(keyword, "minexponent"))
+    {
+        if (parse_int(value, number))
+        {
+            ctx.min_exponent = number;
+        }
+    }
+    else if (iequals(keyword, "clamp"))
+    {
+        ctx.clamp = value == "1";
+    }
+    else if (iequals(keyword, "extended"))
+    {
+        ctx.extended = value == "1";
+    }
+
+    return true;
+}
+
+// Splits "id op operand... -> result condition... -- comment"
+inline bool parse_test_case(string_view line, test_case& tc) noexcept
+{
+    std::size_t pos {};
+    string_view token;
+    bool quoted {};
+
+    tc.id = string_view();
+    tc.op = string_view();
+    tc.result = string_view();
+    tc.operand_count = 0U;
+    tc.conditions = 0U;
+
+    if (!next_token(line, pos, tc.id, quoted) || !next_token(line, pos, tc.op, quoted))
+    {
+        return false;
+    }
+
+    bool found_arrow {false};
+    while (next_token(line, pos, token, quoted))
+    {
+        if (!quoted && token == "->")
+        {
+            found_arrow = true;
+            break;
+        }
+
+        if (tc.operand_count == 3U)
+        {
+            return false;
+        }
+
+        tc.operands[tc.operand_count++] = token;
+    }
+
+    if (!found_arrow || !next_token(line, pos, tc.result, quoted))
+    {
+        return false;
+    }
+
+    while (next_token(line, pos, token, quoted))
+    {
+        if (!quoted && token.size() >= 2U && token[0] == '-' && token[1] == '-')
+        {
+            break;
+        }
+
+        tc.conditions |= parse_condition(token);
+    }
+
+    return true;
+}
+
+} // namespace detail
+
+enum class record_kind
+{
+    // Blank lines, "--" comments and free text
+    comment,
+
+    // "keyword: value", already applied to the tokenizer context
+    directive,
+
+    // "id op operand... -> result condition..."
+    test_case
+};
+
+struct record
+{
+    record_kind kind {record_kind::comment};
+
+    // The whole line without its line terminator
+    string_view line;
+
+    // Set for directives
+    string_view keyword;
+    string_view value;
+
+    // Set for test cases, including the context in effect at this line
+    test_case tc;
+};
+
+class tokenizer
+{
+public:
+    explicit tokenizer(string_view text) noexcept : text_ {text} {}
+
+    // Reads the next line into r, returns false at the end of the text
+    bool next(record& r) noexcept
+    {
+        if (pos_ >= text_.size())
+        {
+            return false;
+        }
+
+        auto end {text_.find('\n', pos_)};
+        if (end == string_view::npos)
+        {
+            end = text_.size();
+        }
+
+        r.line = detail::trim(text_.substr(pos_, end - pos_));
+        r.keyword = string_view();
+        r.value = string_view();
+        pos_ = end + 1U;
+        ++line_number_;
+
+        if (r.line.empty() || r.line.starts_with("--"))
+        {
+            r.kind = record_kind::comment;
+            return true;
+        }
+
+        if (r.line.find("->") == string_view::npos)
+        {
+            r.kind = detail::parse_directive(r.line, ctx_, r.keyword, r.value) ? record_kind::directive : record_kind::comment;
+            return true;
+        }
+
+        r.kind = record_kind::test_case;
+        r.tc.ctx = ctx_;
+        r.tc.line = line_number_;
+        r.tc.flags = 0U;
+
+        if (r.line.find('#') != string_view::npos)
+        {
+            r.tc.flags |= case_flags::hash_marker;
+        }
+        if (!detail::parse_test_case(r.line, r.tc))
+        {
+            r.tc.flags |= case_flags::malformed;
+        }
+
+        return true;
+    }
+
+    // Reads records until the next test case, returns false at the end of the text
+    bool next_test_case(record& r) noexcept
+    {
+        while (next(r))
+        {
+            if (r.kind == record_kind::test_case)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    const context& ctx() const noexcept { return ctx_; }
+    std::uint32_t line_number() const noexcept { return line_number_; }
+
+private:
+    string_view text_;
+    std::size_t pos_ {};
+    std::uint32_t line_number_ {};
+    context ctx_;
+};
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_TOKENIZER_HPP
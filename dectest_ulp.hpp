@@ -0,0 +1,190 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECTEST_ULP_HPP
+#define BOOST_DECIMAL_DECTEST_ULP_HPP
+
+// Exact distance in units in the last place between two decimals of the same type.
+//
+// frexp10 splits a finite value into a significand of exactly numeric_limits<T>::digits digits and an exponent,
+// from which the position of the value among all the representable values of its sign is an integer:
+// there are 9 * 10^(digits - 1) of them in each decade, and the subnormals below the smallest normal
+// are spaced like the lowest decade. The distance is then a subtraction of two such positions,
+// done in the significand type, which is wide enough for every position of the format.
+//
+// The one and two argument handlers that check with a ULP tolerance record every distance
+// in an ulp_histogram, and dectest_runner prints it with the totals of the file
+
+#include <boost/decimal.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+namespace detail {
+
+template <typename T>
+using significand_of = decltype(frexp10(T {}, static_cast<int*>(nullptr)));
+
+// 9 * 10^(digits - 1), the number of values in a decade
+template <typename T>
+significand_of<T> values_per_decade() noexcept
+{
+    significand_of<T> count {9U};
+    for (int i {1}; i < std::numeric_limits<T>::digits; ++i)
+    {
+        count *= 10U;
+    }
+
+    return count;
+}
+
+// The position of the magnitude of a finite x among the values of T, 0 for zero
+template <typename T>
+significand_of<T> ulp_position(const T x) noexcept
+{
+    static const auto per_decade {values_per_decade<T>()};
+
+    // The exponent of the smallest normal is also the exponent of the subnormals
+    static const auto min_exponent = []
+    {
+        int exp {};
+        static_cast<void>(frexp10(std::numeric_limits<T>::min(), &exp));
+        return exp;
+    }();
+
+    int exp {};
+    auto sig {frexp10(x, &exp)};
+
+    // A subnormal comes back scaled up to the full number of digits, its trailing zeros are dropped again
+    while (exp < min_exponent && sig != 0U)
+    {
+        sig /= 10U;
+        ++exp;
+    }
+
+    if (sig == 0U)
+    {
+        return sig;
+    }
+
+    return sig + static_cast<significand_of<T>>(static_cast<unsigned>(exp - min_exponent)) * per_decade;
+}
+
+// decimal128_t distances can be wider than std::size_t
+template <typename U>
+std::size_t saturate(const U distance) noexcept
+{
+    return std::numeric_limits<U>::digits > std::numeric_limits<std::size_t>::digits &&
+           distance > static_cast<U>(std::numeric_limits<std::size_t>::max()) ?
+           std::numeric_limits<std::size_t>::max() :
+           static_cast<std::size_t>(distance);
+}
+
+} // namespace detail
+
+// Counts ULP distances in power of two buckets. Recording is thread safe so run_parallel can share one
+class ulp_histogram
+{
+public:
+    // Bucket 0 counts the exact results, bucket i the distances in [2^(i - 1), 2^i)
+    static constexpr std::size_t bucket_count {std::numeric_limits<std::size_t>::digits + 1};
+
+    void record(const std::size_t distance) noexcept
+    {
+        std::size_t bucket {};
+        while (bucket < bucket_count - 1U && (distance >> bucket) != 0U)
+        {
+            ++bucket;
+        }
+
+        buckets_[bucket].fetch_add(1U, std::memory_order_relaxed);
+
+        auto current {max_.load(std::memory_order_relaxed)};
+        while (distance > current && !max_.compare_exchange_weak(current, distance, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void reset() noexcept
+    {
+        for (auto& bucket : buckets_)
+        {
+            bucket.store(0U, std::memory_order_relaxed);
+        }
+
+        max_.store(0U, std::memory_order_relaxed);
+    }
+
+    std::size_t count(const std::size_t bucket) const noexcept { return buckets_[bucket].load(std::memory_order_relaxed); }
+
+    std::size_t size() const noexcept
+    {
+        std::size_t total {};
+        for (std::size_t i {}; i < bucket_count; ++i)
+        {
+            total += count(i);
+        }
+
+        return total;
+    }
+
+    std::size_t max() const noexcept { return max_.load(std::memory_order_relaxed); }
+
+    void print(const std::string& op, const std::string& file_path, std::ostream& os = std::cerr) const
+    {
+        const auto total {size()};
+        if (total == 0U)
+        {
+            return;
+        }
+
+        std::size_t last {bucket_count - 1U};
+        while (count(last) == 0U)
+        {
+            --last;
+        }
+
+        std::size_t peak {};
+        for (std::size_t i {}; i <= last; ++i)
+        {
+            peak = std::max(peak, count(i));
+        }
+
+        constexpr std::size_t bar_width {50U};
+
+        os << "\nULP error of " << op << " in " << file_path << ", " << total << " cases, max " << max() << '\n';
+
+        for (std::size_t i {}; i <= last; ++i)
+        {
+            const auto low {i == 0U ? std::size_t(0) : std::size_t(1) << (i - 1U)};
+            const auto high {i == 0U ? std::size_t(0) : i < bucket_count - 1U ? (std::size_t(1) << i) - 1U : std::numeric_limits<std::size_t>::max()};
+
+            os << std::right << std::setw(20) << low << " - " << std::left << std::setw(20) << high
+               << std::right << std::setw(8) << count(i) << "  "
+               << std::string((count(i) * bar_width + peak - 1U) / peak, '#') << '\n';
+        }
+
+        os << std::endl;
+    }
+
+private:
+    std::array<std::atomic<std::size_t>, bucket_count> buckets_ {};
+    std::atomic<std::size_t> max_ {0U};
+};
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECTEST_ULP_HPP
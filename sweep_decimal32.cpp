@@ -0,0 +1,489 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Exhaustive sweep of the unary operations over all 2^32 decimal32_t bit patterns.
+//
+// The decTest files only cover a few hundred points of abs, minus, plus, sqrt, tointegral and toSci,
+// for decimal32_t the whole input space can be enumerated instead. Every bit pattern is checked for:
+//
+//   minus       -x flips the sign bit and nothing else
+//   abs         abs(x) clears the sign bit of everything but NaN, and abs(x) == abs(-x)
+//   plus        x + 0 == x and the result is canonically encoded
+//   sqrt        sqrt(x)^2 is within --sqrt-tol epsilons of x, NaN for x < 0
+//   tointegral  nearbyint(x) is an integer within 0.5 of x
+//   toSci       to_chars then from_chars gives back the same value
+//
+// The space is cut into chunks that the worker threads take in turn. Every --progress seconds
+// the sweep prints how far it got and writes the checkpoint: the first chunk not yet done and the failures
+// found below it. Starting again with the same --checkpoint continues from there, with the same --begin and --end.
+//
+// Usage: sweep_decimal32 [--threads N] [--begin X] [--end X] [--checkpoint FILE] [--sqrt-tol N] [--progress S]
+//
+// --begin and --end take bit patterns (e.g. 0x30000000) and default to the whole space
+
+#include <boost/decimal.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace boost::decimal;
+
+namespace {
+
+enum invariant : std::size_t
+{
+    minus_check,
+    abs_check,
+    plus_check,
+    sqrt_check,
+    tointegral_check,
+    tosci_check,
+    invariant_count
+};
+
+constexpr const char* invariant_names[invariant_count] {"minus", "abs", "plus", "sqrt", "tointegral", "toSci"};
+
+using failure_counts = std::array<std::uint64_t, invariant_count>;
+
+constexpr std::uint64_t chunk_size {std::uint64_t(1) << 20};
+constexpr std::uint64_t max_printed_failures {10U};
+
+struct options
+{
+    std::size_t threads {};
+    std::uint64_t begin {};
+    std::uint64_t end {std::uint64_t(1) << 32};
+    std::string checkpoint;
+    int sqrt_tol {2};
+    int progress {10};
+};
+
+// Finite encodings with a significand above 9'999'999 are not canonical and read as zero
+bool is_canonical(const std::uint32_t bits) noexcept
+{
+    constexpr std::uint32_t combination_mask {UINT32_C(0x60000000)};
+    constexpr std::uint32_t special_mask {UINT32_C(0x78000000)};
+
+    if ((bits & special_mask) == special_mask)
+    {
+        // Infinity and NaN
+        return true;
+    }
+
+    if ((bits & combination_mask) != combination_mask)
+    {
+        // The small form holds at most 2^23 - 1
+        return true;
+    }
+
+    const auto significand {UINT32_C(0x800000) | (bits & UINT32_C(0x1FFFFF))};
+    return significand <= UINT32_C(9999999);
+}
+
+std::mutex output_mutex;
+
+class sweeper
+{
+public:
+    explicit sweeper(const options& opts) : opts_ {opts} {}
+
+    void check(const std::uint32_t bits, failure_counts& failures)
+    {
+        const auto x {from_bid<decimal32_t>(bits)};
+
+        // minus
+        if (to_bid(-x) != (bits ^ UINT32_C(0x80000000)))
+        {
+            fail(minus_check, bits, failures);
+        }
+
+        // abs
+        if (isnan(x))
+        {
+            if (!isnan(abs(x)))
+            {
+                fail(abs_check, bits, failures);
+            }
+        }
+        else if (to_bid(abs(x)) != (bits & UINT32_C(0x7FFFFFFF)) || abs(x) != abs(-x))
+        {
+            fail(abs_check, bits, failures);
+        }
+
+        // plus
+        const auto plus {x + decimal32_t {0}};
+        if (isnan(x) ? !isnan(plus) : (plus != x || !is_canonical(to_bid(plus))))
+        {
+            fail(plus_check, bits, failures);
+        }
+
+        // sqrt, squared in decimal64_t so that the square itself does not round
+        const auto root {sqrt(x)};
+        if (isnan(x) || x < 0)
+        {
+            if (!isnan(root))
+            {
+                fail(sqrt_check, bits, failures);
+            }
+        }
+        else if (isinf(x))
+        {
+            if (root != x)
+            {
+                fail(sqrt_check, bits, failures);
+            }
+        }
+        else
+        {
+            const decimal64_t wide_x {x};
+            const decimal64_t wide_root {root};
+            const auto diff {abs(wide_root * wide_root - wide_x)};
+            const decimal64_t tol {static_cast<decimal64_t>(std::numeric_limits<decimal32_t>::epsilon()) * opts_.sqrt_tol};
+
+            if (diff > tol * wide_x && !(x == 0 && root == 0))
+            {
+                fail(sqrt_check, bits, failures);
+            }
+        }
+
+        // tointegral, the difference is exact in decimal64_t
+        if (isfinite(x))
+        {
+            const auto integral {nearbyint(x)};
+            const decimal64_t diff {abs(decimal64_t {x} - decimal64_t {integral})};
+            if (trunc(integral) != integral || diff > decimal64_t {5, -1})
+            {
+                fail(tointegral_check, bits, failures);
+            }
+        }
+
+        // toSci round trip
+        char buffer[64] {};
+        const auto to {to_chars(buffer, buffer + sizeof(buffer), x)};
+        decimal32_t parsed;
+        const auto from {from_chars(buffer, to.ptr, parsed)};
+        if (to.ec != std::errc() || from.ec != std::errc() || from.ptr != to.ptr ||
+            (isnan(x) ? !isnan(parsed) : (parsed != x || signbit(parsed) != signbit(x))))
+        {
+            fail(tosci_check, bits, failures);
+        }
+    }
+
+private:
+    void fail(const invariant which, const std::uint32_t bits, failure_counts& failures)
+    {
+        ++failures[which];
+        if (printed_[which].fetch_add(1U, std::memory_order_relaxed) < max_printed_failures)
+        {
+            std::lock_guard<std::mutex> lock {output_mutex};
+            std::cerr << "Failed " << invariant_names[which] << ": 0x" << std::hex << std::setw(8) << std::setfill('0')
+                      << bits << std::dec << std::setfill(' ') << std::endl;
+        }
+    }
+
+    const options& opts_;
+    std::array<std::atomic<std::uint64_t>, invariant_count> printed_ {};
+};
+
+bool parse_number(const char* str, std::uint64_t& value)
+{
+    char* end {};
+    value = std::strtoull(str, &end, 0);
+    return end != str && *end == '\0';
+}
+
+bool parse_options(const int argc, char** argv, options& opts)
+{
+    for (int i {1}; i < argc; ++i)
+    {
+        const std::string arg {argv[i]};
+        if (i + 1 == argc)
+        {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+
+        const char* value {argv[++i]};
+        std::uint64_t number {};
+
+        if (arg == "--checkpoint")
+        {
+            opts.checkpoint = value;
+            continue;
+        }
+
+        if (!parse_number(value, number))
+        {
+            std::cerr << "Invalid value for " << arg << ": " << value << std::endl;
+            return false;
+        }
+
+        if (arg == "--threads")
+        {
+            opts.threads = static_cast<std::size_t>(number);
+        }
+        else if (arg == "--begin")
+        {
+            opts.begin = number;
+        }
+        else if (arg == "--end")
+        {
+            opts.end = number;
+        }
+        else if (arg == "--sqrt-tol")
+        {
+            opts.sqrt_tol = static_cast<int>(number);
+        }
+        else if (arg == "--progress")
+        {
+            opts.progress = static_cast<int>(number);
+        }
+        else
+        {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+
+    opts.end = std::min(opts.end, std::uint64_t(1) << 32);
+    return opts.begin < opts.end;
+}
+
+struct checkpoint_state
+{
+    std::uint64_t begin {};
+    std::uint64_t next {};
+    std::uint64_t end {};
+    failure_counts failures {};
+};
+
+// Checkpoint format, one "key value" pair per line:
+//   begin <start of the sweep>
+//   next <first bit pattern not yet checked>
+//   end <end of the sweep>
+//   <invariant> <failures found before next>
+bool read_checkpoint(const std::string& path, checkpoint_state& state)
+{
+    std::ifstream in {path};
+    if (!in.is_open())
+    {
+        return false;
+    }
+
+    std::string key;
+    std::uint64_t value {};
+    while (in >> key >> value)
+    {
+        if (key == "begin")
+        {
+            state.begin = value;
+        }
+        else if (key == "next")
+        {
+            state.next = value;
+        }
+        else if (key == "end")
+        {
+            state.end = value;
+        }
+        else
+        {
+            for (std::size_t i {}; i < invariant_count; ++i)
+            {
+                if (key == invariant_names[i])
+                {
+                    state.failures[i] = value;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+void write_checkpoint(const std::string& path, const std::uint64_t begin, const std::uint64_t next, const std::uint64_t end, const failure_counts& failures)
+{
+    // Write then rename so that an interrupted write never leaves a broken checkpoint
+    const auto temp {path + ".tmp"};
+    {
+        std::ofstream out {temp, std::ios::trunc};
+        out << "begin " << begin << "\nnext " << next << "\nend " << end << '\n';
+        for (std::size_t i {}; i < invariant_count; ++i)
+        {
+            out << invariant_names[i] << ' ' << failures[i] << '\n';
+        }
+    }
+
+    std::remove(path.c_str());
+    std::rename(temp.c_str(), path.c_str());
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    options opts;
+    if (!parse_options(argc, argv, opts))
+    {
+        std::cerr << "Usage: " << argv[0] << " [--threads N] [--begin X] [--end X] [--checkpoint FILE] [--sqrt-tol N] [--progress S]" << std::endl;
+        return 1;
+    }
+
+    // The checkpoint counts the failures of its own range, so it is only resumed for the same one
+    const auto sweep_begin {opts.begin};
+    failure_counts resumed {};
+    checkpoint_state saved;
+    if (!opts.checkpoint.empty() && read_checkpoint(opts.checkpoint, saved))
+    {
+        if (saved.begin != opts.begin || saved.end != opts.end || saved.next < saved.begin || saved.next > saved.end)
+        {
+            std::cerr << std::hex << "The checkpoint " << opts.checkpoint << " is of the sweep from 0x" << saved.begin << " to 0x" << saved.end
+                      << ", not of --begin 0x" << opts.begin << " --end 0x" << opts.end << std::dec << std::endl;
+            return 1;
+        }
+
+        opts.begin = saved.next;
+        resumed = saved.failures;
+        std::cout << "Resuming from 0x" << std::hex << opts.begin << std::dec << std::endl;
+    }
+
+    if (opts.threads == 0U)
+    {
+        const auto hardware {std::thread::hardware_concurrency()};
+        opts.threads = hardware == 0U ? 1U : hardware;
+    }
+
+    const auto begin {opts.begin};
+    const auto end {opts.end};
+    const auto num_chunks {static_cast<std::size_t>((end - begin + chunk_size - 1U) / chunk_size)};
+
+    // Failures are kept per chunk so the checkpoint only counts the chunks below its watermark
+    std::vector<failure_counts> chunk_failures(num_chunks);
+    std::vector<std::atomic<bool>> chunk_done(num_chunks);
+    for (auto& done : chunk_done)
+    {
+        done.store(false);
+    }
+
+    std::atomic<std::size_t> next_chunk {0U};
+    std::atomic<std::uint64_t> values_done {0U};
+    std::atomic<std::size_t> workers_running {opts.threads};
+
+    sweeper sweep {opts};
+
+    const auto worker = [&]()
+    {
+        for (auto chunk {next_chunk.fetch_add(1U)}; chunk < num_chunks; chunk = next_chunk.fetch_add(1U))
+        {
+            const auto first {begin + chunk * chunk_size};
+            const auto last {std::min(first + chunk_size, end)};
+
+            failure_counts failures {};
+            for (auto bits {first}; bits < last; ++bits)
+            {
+                sweep.check(static_cast<std::uint32_t>(bits), failures);
+            }
+
+            chunk_failures[chunk] = failures;
+            chunk_done[chunk].store(true, std::memory_order_release);
+            values_done.fetch_add(last - first, std::memory_order_relaxed);
+        }
+
+        workers_running.fetch_sub(1U);
+    };
+
+    const auto start {std::chrono::steady_clock::now()};
+
+    std::vector<std::thread> pool;
+    for (std::size_t i {}; i < opts.threads; ++i)
+    {
+        pool.emplace_back(worker);
+    }
+
+    std::size_t watermark {};
+    failure_counts below_watermark {resumed};
+
+    const auto advance_watermark = [&]()
+    {
+        while (watermark < num_chunks && chunk_done[watermark].load(std::memory_order_acquire))
+        {
+            for (std::size_t i {}; i < invariant_count; ++i)
+            {
+                below_watermark[i] += chunk_failures[watermark][i];
+            }
+            ++watermark;
+        }
+    };
+
+    const auto checked_until = [&]() { return std::min(begin + watermark * chunk_size, end); };
+
+    auto last_report {start};
+    while (workers_running.load() > 0U)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        const auto now {std::chrono::steady_clock::now()};
+        if (now - last_report < std::chrono::seconds(opts.progress))
+        {
+            continue;
+        }
+        last_report = now;
+
+        advance_watermark();
+        if (!opts.checkpoint.empty())
+        {
+            write_checkpoint(opts.checkpoint, sweep_begin, checked_until(), end, below_watermark);
+        }
+
+        const auto done {static_cast<double>(values_done.load())};
+        const auto seconds {std::chrono::duration<double>(now - start).count()};
+        const auto rate {done / seconds};
+        const auto total {static_cast<double>(end - begin)};
+
+        std::lock_guard<std::mutex> lock {output_mutex};
+        std::cout << std::fixed << std::setprecision(1) << 100.0 * done / total << "% done, "
+                  << rate / 1e6 << "M values/s, about " << (total - done) / rate << " s left" << std::endl;
+    }
+
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+
+    advance_watermark();
+    if (!opts.checkpoint.empty())
+    {
+        write_checkpoint(opts.checkpoint, sweep_begin, checked_until(), end, below_watermark);
+    }
+
+    const auto seconds {std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+    const auto total {static_cast<double>(end - begin)};
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "\nChecked " << static_cast<std::uint64_t>(total) << " bit patterns on " << opts.threads << " threads in "
+              << seconds << " s (" << total / seconds / 1e6 << "M values/s)\n";
+
+    std::uint64_t total_failures {};
+    for (std::size_t i {}; i < invariant_count; ++i)
+    {
+        std::cout << std::left << std::setw(12) << invariant_names[i] << std::right << below_watermark[i] << " failures\n";
+        total_failures += below_watermark[i];
+    }
+    std::cout << std::flush;
+
+    return total_failures == 0U ? 0 : 1;
+}
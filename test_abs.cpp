@@ -5,13 +5,11 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    test_one_arg_harness("dectest0/abs0.decTest", "abs", [](const auto x) { return boost::decimal::abs(x); });
-    test_one_arg_harness("dectest/abs.decTest", "abs", [](const auto x) { return boost::decimal::abs(x); });
-    test_one_arg_harness("dectest/ddAbs.decTest", "abs", [](const auto x) { return boost::decimal::abs(x); });
-    test_one_arg_harness("dectest/dqAbs.decTest", "abs", [](const auto x) { return boost::decimal::abs(x); });
+    boost::decimal::dectest::run_registered("abs", boost::decimal::dectest::register_abs<>);
 
     return boost::report_errors();
 }
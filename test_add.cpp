@@ -5,6 +5,7 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 template <typename T>
 void test_edges(const char* lhs_str, const char* rhs_str, const char* res_str, const boost::decimal::rounding_mode round)
@@ -21,6 +22,35 @@ void test_edges(const char* lhs_str, const char* rhs_str, const char* res_str, c
     BOOST_TEST_EQ(res, expected_res);
 }
 
+// A typed handler per width sees each case of the file exactly once
+void test_typed_widths()
+{
+    using namespace boost::decimal;
+
+    const auto add = [](const auto x, const auto y) { return x + y; };
+    using add_type = decltype(add);
+
+    const auto handler32 {new dectest::typed_handler<decimal32_t, 2U, add_type>(add, 0U)};
+    const auto handler64 {new dectest::typed_handler<decimal64_t, 2U, add_type>(add, 0U)};
+    const auto handler128 {new dectest::typed_handler<decimal128_t, 2U, add_type>(add, 0U)};
+    const auto any_width {new dectest::two_arg_handler<add_type>(add, 0U)};
+
+    dectest::dectest_runner typed;
+    typed.add("add", std::unique_ptr<dectest::op_handler>(handler32))
+         .add("add", std::unique_ptr<dectest::op_handler>(handler64))
+         .add("add", std::unique_ptr<dectest::op_handler>(handler128));
+    typed.run("dectest0/add0.decTest");
+
+    dectest::dectest_runner untyped;
+    untyped.add("add", std::unique_ptr<dectest::op_handler>(any_width));
+    untyped.run("dectest0/add0.decTest");
+
+    BOOST_TEST_GT(handler32->num_tests_found, 0U);
+    BOOST_TEST_GT(handler64->num_tests_found, 0U);
+    BOOST_TEST_EQ(handler128->num_tests_found, 0U);
+    BOOST_TEST_EQ(handler32->num_tests_found + handler64->num_tests_found, any_width->num_tests_found);
+}
+
 int main()
 {
     #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
@@ -31,21 +61,8 @@ int main()
 
     #endif
 
-    test_two_arg_harness("dectest0/add0.decTest", "add", [](const auto x, const auto y) { return x + y; });
-    test_two_arg_harness("dectest0/inexact0.decTest", "add", [](const auto x, const auto y) { return x + y; });
-
-    // Requires rounding-mode changes
-    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
-
-    boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_default);
-    std::cerr << std::setprecision(std::numeric_limits<boost::decimal::decimal64_t>::max_digits10);
-    test_two_arg_harness<true>("dectest/ddAdd.decTest", "add", [](const auto x, const auto y) { return x + y; });
-
-    boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_default);
-    std::cerr << std::setprecision(std::numeric_limits<boost::decimal::decimal128_t>::max_digits10);
-    test_two_arg_harness<true>("dectest/dqAdd.decTest", "add", [](const auto x, const auto y) { return x + y; });
-
-    #endif // BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    boost::decimal::dectest::run_registered("add", boost::decimal::dectest::register_add<>);
+    test_typed_widths();
 
     return boost::report_errors();
 }
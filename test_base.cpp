@@ -5,12 +5,11 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    // Effectively NOOP since we are already performing this string manipulation in the constructors
-    test_one_arg_harness("dectest0/base0.decTest", "toSci", [](const auto x) { return x; });
-    test_one_arg_harness("dectest/base.decTest", "toSci", [](const auto x) { return x; });
+    boost::decimal::dectest::run_registered("toSci", boost::decimal::dectest::register_toSci<>);
 
     return boost::report_errors();
 }
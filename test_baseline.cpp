@@ -0,0 +1,101 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "dectest_baseline.hpp"
+#include <cstdio>
+#include <sstream>
+
+using namespace boost::decimal::dectest;
+
+void test_median()
+{
+    BOOST_TEST_EQ(bench::median({3, 1, 2}), 2.0);
+    BOOST_TEST_EQ(bench::median({4, 1, 3, 2}), 2.5);
+    BOOST_TEST_EQ(bench::median({}), 0.0);
+
+    // One disturbed repeat does not move it
+    BOOST_TEST_EQ(bench::median_absolute_deviation({10, 11, 9, 10, 500}), 1.0);
+}
+
+bench::baseline_entry entry(const char* type, const double ns, const double mad)
+{
+    bench::baseline_entry e;
+    e.file = "dectest/ddAdd.decTest";
+    e.op = "add";
+    e.type = type;
+    e.rounding = "half_even";
+    e.vectors = 100U;
+    e.ns_per_op = ns;
+    e.ns_mad = mad;
+    e.cycles_per_op = 3 * ns;
+    e.repeats = 5U;
+    return e;
+}
+
+void test_round_trip()
+{
+    const std::string path {"test_baseline.csv"};
+
+    bench::baseline b;
+    b.metadata = bench::current_metadata();
+    b.entries.push_back(entry("decimal32_t", 12.5, 0.25));
+    b.entries.push_back(entry("decimal64_t", 20, 0.5));
+
+    BOOST_TEST(bench::write_baseline(path, b));
+
+    bench::baseline read;
+    BOOST_TEST(bench::read_baseline(path, read));
+    BOOST_TEST_EQ(read.entries.size(), 2U);
+    BOOST_TEST_EQ(read.find_metadata("compiler"), b.find_metadata("compiler"));
+
+    const auto e {read.find(entry("decimal64_t", 0, 0))};
+    BOOST_TEST(e != nullptr);
+    if (e != nullptr)
+    {
+        BOOST_TEST_EQ(e->vectors, 100U);
+        BOOST_TEST_EQ(e->ns_per_op, 20.0);
+        BOOST_TEST_EQ(e->ns_mad, 0.5);
+        BOOST_TEST_EQ(e->cycles_per_op, 60.0);
+        BOOST_TEST_EQ(e->repeats, 5U);
+    }
+
+    std::remove(path.c_str());
+}
+
+void test_compare()
+{
+    bench::baseline stored;
+    stored.entries.push_back(entry("decimal32_t", 10, 0.1));
+    stored.entries.push_back(entry("decimal64_t", 10, 0.01));
+    stored.entries.push_back(entry("decimal128_t", 10, 2));
+
+    bench::baseline current;
+
+    // 20% slower and well out of the noise
+    current.entries.push_back(entry("decimal32_t", 12, 0.1));
+
+    // 2% slower, under the threshold
+    current.entries.push_back(entry("decimal64_t", 10.2, 0.01));
+
+    // 20% slower, but the repeats of the baseline were all over the place
+    current.entries.push_back(entry("decimal128_t", 12, 2));
+
+    std::ostringstream out;
+    BOOST_TEST_EQ(bench::compare_baselines(stored, current, bench::comparison_options(), out), 1U);
+
+    bench::comparison_options strict;
+    strict.threshold_percent = 1;
+    BOOST_TEST_EQ(bench::compare_baselines(stored, current, strict, out), 2U);
+}
+
+int main()
+{
+    test_median();
+    test_round_trip();
+    test_compare();
+
+    return boost::report_errors();
+}
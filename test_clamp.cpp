@@ -5,10 +5,11 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    test_one_arg_harness("dectest/clamp.decTest", "apply", [](const auto x) { return x; });
+    boost::decimal::dectest::run_registered("apply", boost::decimal::dectest::register_apply<>);
 
     return boost::report_errors();
 }
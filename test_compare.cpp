@@ -5,17 +5,12 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    test_comparisons("dectest0/compare0.decTest", "compare");
-    test_comparisons("dectest/compare.decTest", "compare");
-    test_comparisons("dectest/ddCompare.decTest", "compare");
-    test_comparisons("dectest/dqCompare.decTest", "compare");
-
-    test_comparisons("dectest/comparesig.decTest", "comparesig");
-    test_comparisons("dectest/ddCompareSig.decTest", "comparesig");
-    test_comparisons("dectest/dqCompareSig.decTest", "comparesig");
+    boost::decimal::dectest::run_registered("compare", boost::decimal::dectest::register_compare<>);
+    boost::decimal::dectest::run_registered("comparesig", boost::decimal::dectest::register_comparesig<>);
 
     return boost::report_errors();
 }
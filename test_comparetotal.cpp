@@ -5,13 +5,11 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    test_comparetotal("dectest0/comparetotal0.decTest", "comparetotal");
-    test_comparetotal("dectest/comparetotal.decTest", "comparetotal");
-    test_comparetotal("dectest/ddCompareTotal.decTest", "comparetotal");
-    test_comparetotal("dectest/dqCompareTotal.decTest", "comparetotal");
+    boost::decimal::dectest::run_registered("comparetotal", boost::decimal::dectest::register_comparetotal<>);
 
     return boost::report_errors();
 }
@@ -0,0 +1,174 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "dectest_corpus.hpp"
+#include "where_file.hpp"
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <fstream>
+#include <cstdio>
+
+using namespace boost::decimal::dectest;
+
+void test_in_memory()
+{
+    const char* text =
+        "-- A comment -> with an arrow\r\n"
+        "version: 2.62\r\n"
+        "\r\n"
+        "precision:   9\r\n"
+        "rounding:    half_up\r\n"
+        "maxExponent: 384\r\n"
+        "minexponent: -383\r\n"
+        "addx001 add 1 1 -> 2\r\n"
+        "addx002 add '5.75'  '3.3'   ->  9.05   -- trailing comment\r\n"
+        "Rounding:    floor\r\n"
+        "addx003 add 1E+384 1E+384 -> Infinity Overflow Inexact Rounded\r\n"
+        "#addx004 add 1 2 -> 3\r\n"
+        "absx001 abs -1 -> 1\r\n"
+        "addx005 add 1 2 3 4 -> 10\r\n";
+
+    corpus_builder builder;
+    builder.add_text("mem/add.decTest", text);
+    BOOST_TEST_EQ(builder.group_count(), 2U);
+    BOOST_TEST_EQ(builder.record_count(), 6U);
+
+    corpus c;
+    BOOST_TEST(c.open_buffer(builder.serialize()));
+    BOOST_TEST_EQ(c.record_count(), 6U);
+
+    BOOST_TEST(c.find("mem/add.decTest", "subtract").empty());
+    BOOST_TEST(c.find("mem/other.decTest", "add").empty());
+
+    const auto adds {c.find("mem/add.decTest", "add")};
+    BOOST_TEST_EQ(adds.size(), 5U);
+
+    auto it {adds.begin()};
+    auto tc {*it};
+    BOOST_TEST_EQ(tc.id(), "addx001");
+    BOOST_TEST_EQ(tc.op(), "add");
+    BOOST_TEST_EQ(tc.operand_count(), 2U);
+    BOOST_TEST_EQ(tc.operand(0), "1");
+    BOOST_TEST_EQ(tc.operand(1), "1");
+    BOOST_TEST_EQ(tc.result(), "2");
+    BOOST_TEST_EQ(tc.precision(), 9);
+    BOOST_TEST(tc.round() == rounding::half_up);
+    BOOST_TEST_EQ(tc.conditions(), 0U);
+    BOOST_TEST_EQ(tc.line(), 8U);
+
+    tc = *++it;
+    BOOST_TEST_EQ(tc.operand(0), "5.75");
+    BOOST_TEST_EQ(tc.operand(1), "3.3");
+    BOOST_TEST_EQ(tc.result(), "9.05");
+    BOOST_TEST_EQ(tc.conditions(), 0U);
+
+    tc = *++it;
+    BOOST_TEST(tc.round() == rounding::floor);
+    BOOST_TEST_EQ(tc.conditions(), condition::overflow | condition::inexact | condition::rounded);
+    BOOST_TEST_EQ(tc.flags(), 0U);
+
+    const auto full {tc.to_test_case()};
+    BOOST_TEST_EQ(full.ctx.max_exponent, 384);
+    BOOST_TEST_EQ(full.ctx.min_exponent, -383);
+
+    tc = *++it;
+    BOOST_TEST_EQ(tc.op(), "add");
+    BOOST_TEST_EQ(tc.flags(), case_flags::hash_marker);
+
+    tc = *++it;
+    BOOST_TEST_EQ(tc.id(), "addx005");
+    BOOST_TEST((tc.flags() & case_flags::malformed) != 0U);
+
+    BOOST_TEST(++it == adds.end());
+
+    const auto abs_cases {c.find("mem/add.decTest", "abs")};
+    BOOST_TEST_EQ(abs_cases.size(), 1U);
+    BOOST_TEST_EQ((*abs_cases.begin()).operand_count(), 1U);
+}
+
+void test_mapped_file()
+{
+    const auto full_path {where_file("dectest/ddAdd.decTest")};
+    if (full_path.empty())
+    {
+        BOOST_TEST(false);
+        return;
+    }
+
+    corpus_builder builder;
+    BOOST_TEST(builder.add_file("dectest/ddAdd.decTest", full_path));
+
+    const std::string corpus_path {"test_corpus_ddAdd.corpus"};
+    BOOST_TEST(builder.write(corpus_path));
+
+    {
+        corpus c;
+        BOOST_TEST(c.open(corpus_path));
+
+        const auto cases {c.find("dectest/ddAdd.decTest", "add")};
+        const auto applies {c.find("dectest/ddAdd.decTest", "apply")};
+        BOOST_TEST_EQ(cases.size() + applies.size(), builder.record_count());
+        BOOST_TEST_EQ((*cases.begin()).id(), "ddadd001");
+
+        BOOST_TEST(c.is_current("dectest/ddAdd.decTest", full_path));
+
+        std::size_t count {};
+        for (const auto tc : cases)
+        {
+            BOOST_TEST_EQ(tc.precision(), 16);
+            ++count;
+        }
+        BOOST_TEST_EQ(count, cases.size());
+    }
+
+    std::remove(corpus_path.c_str());
+
+    // Text of an in-memory image has no file to be older than
+    corpus_builder text_only;
+    text_only.add_text("dectest/ddAdd.decTest", "ddadd001 add 1 1 -> 2\n");
+    corpus from_text;
+    BOOST_TEST(from_text.open_buffer(text_only.serialize()));
+    BOOST_TEST(from_text.is_current("dectest/ddAdd.decTest", full_path));
+
+    // Anything that is not a corpus must be rejected rather than mapped
+    corpus bad;
+    BOOST_TEST(!bad.open(full_path));
+    BOOST_TEST(!bad.open_buffer("DECTEST"));
+    BOOST_TEST(!bad.is_open());
+}
+
+// Editing a file after the corpus was compiled makes the corpus stale for it
+void test_stale_file()
+{
+    const std::string text_path {"test_corpus_stale.decTest"};
+    {
+        std::ofstream out(text_path.c_str());
+        out << "precision: 16\nstalex001 add 1 1 -> 2\n";
+    }
+
+    corpus_builder builder;
+    BOOST_TEST(builder.add_file("stale.decTest", text_path));
+
+    corpus c;
+    BOOST_TEST(c.open_buffer(builder.serialize()));
+    BOOST_TEST(c.is_current("stale.decTest", text_path));
+
+    {
+        std::ofstream out(text_path.c_str(), std::ios::app);
+        out << "stalex002 add 1 2 -> 3\n";
+    }
+
+    BOOST_TEST(!c.is_current("stale.decTest", text_path));
+
+    std::remove(text_path.c_str());
+}
+
+int main()
+{
+    test_in_memory();
+    test_mapped_file();
+    test_stale_file();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,247 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Runs vectors that dectest_embed compiled into the binary, so no file is opened.
+// The headers are generated by the CMake build, see CMakeLists.txt.
+//
+// The harness takes the operands and results of these cases from their stored bits, nothing is parsed.
+//
+// With BOOST_DECIMAL_DECTEST_STATIC_CHECKS defined (C++20, where from_bid is constexpr) the first
+// BOOST_DECIMAL_DECTEST_STATIC_CASES half_even cases of each op are also evaluated during compilation.
+// A wrong result fails the build, and the verdicts are compared with the same evaluation at run time
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest0_add0.hpp"
+#include "dectest0_subtract0.hpp"
+#include "dectest0_multiply0.hpp"
+#include "dectest0_divide0.hpp"
+
+using namespace boost::decimal;
+using namespace boost::decimal::dectest;
+
+template <typename T>
+bool same_value(const T lhs, const T rhs)
+{
+    return isnan(lhs) ? isnan(rhs) : (lhs == rhs && signbit(lhs) == signbit(rhs));
+}
+
+template <typename T>
+void check_bits(const embedded_case& c)
+{
+    for (std::size_t i {}; i < c.operand_count; ++i)
+    {
+        if ((c.has_bits & (1U << i)) != 0U && !BOOST_TEST(same_value(from_embedded_bits<T>(c.operand_bits[i]), make_decimal<T>(c.operands[i]))))
+        {
+            std::cerr << "Operand " << i << " of " << c.id << " does not match its bits" << std::endl;
+        }
+    }
+
+    if ((c.has_bits & embedded_bits::result) != 0U && !BOOST_TEST(same_value(from_embedded_bits<T>(c.result_bits), make_decimal<T>(c.result))))
+    {
+        std::cerr << "Result of " << c.id << " does not match its bits" << std::endl;
+    }
+}
+
+// The stored bits must decode to what the harness constructs from the strings
+void test_bits(const embedded_file& file)
+{
+    for (std::size_t i {}; i < file.count; ++i)
+    {
+        const auto& c {file.cases[i]};
+        switch (c.width)
+        {
+            case 32U:
+                check_bits<decimal32_t>(c);
+                break;
+            case 64U:
+                check_bits<decimal64_t>(c);
+                break;
+            default:
+                check_bits<decimal128_t>(c);
+                break;
+        }
+    }
+}
+
+void test_registered()
+{
+    BOOST_TEST(embedded_registrar::find("dectest0/add0.decTest") != nullptr);
+    BOOST_TEST(embedded_registrar::find("dectest0/divide0.decTest") != nullptr);
+    BOOST_TEST(embedded_registrar::find("dectest0/power0.decTest") == nullptr);
+
+    // Served from the tables, in file order and with the same ids
+    std::size_t visited {};
+    const auto found {for_each_case("dectest0/add0.decTest", "add", [&](const test_case& tc)
+    {
+        if (visited < embedded::dectest0_add0.count)
+        {
+            BOOST_TEST_EQ(tc.id, embedded::dectest0_add0.cases[visited].id);
+        }
+        ++visited;
+    })};
+
+    BOOST_TEST(found);
+    BOOST_TEST_EQ(visited, embedded::dectest0_add0.count);
+
+    // The operands reach the handlers as the stored bits
+    const auto& first {embedded::dectest0_add0.cases[0]};
+    const auto tc {to_test_case(first)};
+    BOOST_TEST(tc.embedded == &first);
+
+    decimal32_t value;
+    BOOST_TEST_EQ(embedded_value(first, 0U, value), (first.width == 32U && (first.has_bits & 1U) != 0U));
+
+    decimal_fast32_t fast;
+    BOOST_TEST(!embedded_value(first, 0U, fast));
+}
+
+#ifdef BOOST_DECIMAL_DECTEST_STATIC_CHECKS
+
+#ifndef BOOST_DECIMAL_DECTEST_STATIC_CASES
+#  define BOOST_DECIMAL_DECTEST_STATIC_CASES 32
+#endif
+
+constexpr std::size_t static_cases {BOOST_DECIMAL_DECTEST_STATIC_CASES};
+
+struct add_op { template <typename T> constexpr T operator()(T x, T y) const noexcept { return x + y; } };
+struct subtract_op { template <typename T> constexpr T operator()(T x, T y) const noexcept { return x - y; } };
+struct multiply_op { template <typename T> constexpr T operator()(T x, T y) const noexcept { return x * y; } };
+struct divide_op { template <typename T> constexpr T operator()(T x, T y) const noexcept { return x / y; } };
+
+struct static_verdicts
+{
+    std::size_t index[static_cases] {};
+    bool passed[static_cases] {};
+    std::size_t count {};
+};
+
+template <typename T, typename Function>
+constexpr bool agrees(const embedded_case& c, Function f) noexcept
+{
+    const auto res {f(from_embedded_bits<T>(c.operand_bits[0]), from_embedded_bits<T>(c.operand_bits[1]))};
+    const auto expected {from_embedded_bits<T>(c.result_bits)};
+    return isnan(expected) ? isnan(res) : (res == expected && signbit(res) == signbit(expected));
+}
+
+// The half_even cases, the mode of the library during constant evaluation, and the exact cases of any mode
+// whose precision the width holds, so that their result does not depend on the mode
+constexpr bool static_mode(const embedded_case& c) noexcept
+{
+    const auto digits {c.width == 32U ? std::numeric_limits<decimal32_t>::digits :
+                       c.width == 64U ? std::numeric_limits<decimal64_t>::digits :
+                                        std::numeric_limits<decimal128_t>::digits};
+
+    return static_cast<rounding>(c.round) == rounding::half_even ||
+           ((c.conditions & (condition::inexact | condition::rounded)) == 0U && c.precision <= digits);
+}
+
+// Evaluates the first static_cases two operand cases with all of their bits, see static_mode
+template <typename Function>
+constexpr static_verdicts evaluate(const embedded_file& file, Function f) noexcept
+{
+    constexpr std::uint8_t all_bits {3U | embedded_bits::result};
+
+    static_verdicts verdicts {};
+    for (std::size_t i {}; i < file.count && verdicts.count < static_cases; ++i)
+    {
+        const auto& c {file.cases[i]};
+        if (c.flags != 0U || c.operand_count != 2U || (c.has_bits & all_bits) != all_bits || !static_mode(c))
+        {
+            continue;
+        }
+
+        verdicts.index[verdicts.count] = i;
+        verdicts.passed[verdicts.count] = c.width == 32U ? agrees<decimal32_t>(c, f) :
+                                          c.width == 64U ? agrees<decimal64_t>(c, f) :
+                                                           agrees<decimal128_t>(c, f);
+        ++verdicts.count;
+    }
+
+    return verdicts;
+}
+
+constexpr bool all_passed(const static_verdicts& verdicts) noexcept
+{
+    for (std::size_t i {}; i < verdicts.count; ++i)
+    {
+        if (!verdicts.passed[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// compile_time must be a constant expression, so any operation the library can not evaluate at compile time fails the build
+void compare_verdicts(const embedded_file& file, const static_verdicts& compile_time, const static_verdicts& run_time)
+{
+    BOOST_TEST_EQ(compile_time.count, run_time.count);
+
+    std::size_t passed {};
+    for (std::size_t i {}; i < compile_time.count && i < run_time.count; ++i)
+    {
+        if (!BOOST_TEST_EQ(compile_time.passed[i], run_time.passed[i]))
+        {
+            std::cerr << "Compile time and run time disagree on: " << file.cases[compile_time.index[i]].id << std::endl;
+        }
+
+        passed += compile_time.passed[i] ? 1U : 0U;
+    }
+
+    std::cerr << file.path << ": " << passed << " of " << compile_time.count << " cases match the expected result at compile time" << std::endl;
+}
+
+void test_static_checks()
+{
+    constexpr auto add {evaluate(embedded::dectest0_add0, add_op {})};
+    constexpr auto subtract {evaluate(embedded::dectest0_subtract0, subtract_op {})};
+    constexpr auto multiply {evaluate(embedded::dectest0_multiply0, multiply_op {})};
+    constexpr auto divide {evaluate(embedded::dectest0_divide0, divide_op {})};
+
+    static_assert(add.count > 0U, "No add case was evaluated at compile time");
+    static_assert(subtract.count > 0U, "No subtract case was evaluated at compile time");
+    static_assert(multiply.count > 0U, "No multiply case was evaluated at compile time");
+    static_assert(divide.count > 0U, "No divide case was evaluated at compile time");
+
+    static_assert(all_passed(add), "An add case fails at compile time");
+    static_assert(all_passed(subtract), "A subtract case fails at compile time");
+    static_assert(all_passed(multiply), "A multiply case fails at compile time");
+    static_assert(all_passed(divide), "A divide case fails at compile time");
+
+    boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_default);
+
+    compare_verdicts(embedded::dectest0_add0, add, evaluate(embedded::dectest0_add0, add_op {}));
+    compare_verdicts(embedded::dectest0_subtract0, subtract, evaluate(embedded::dectest0_subtract0, subtract_op {}));
+    compare_verdicts(embedded::dectest0_multiply0, multiply, evaluate(embedded::dectest0_multiply0, multiply_op {}));
+    compare_verdicts(embedded::dectest0_divide0, divide, evaluate(embedded::dectest0_divide0, divide_op {}));
+}
+
+#endif // BOOST_DECIMAL_DECTEST_STATIC_CHECKS
+
+int main()
+{
+    std::cerr << std::setprecision(17);
+
+    test_registered();
+
+    test_bits(embedded::dectest0_add0);
+    test_bits(embedded::dectest0_subtract0);
+    test_bits(embedded::dectest0_multiply0);
+    test_bits(embedded::dectest0_divide0);
+
+    // The same runs as the serial tests, without reading the files
+    test_two_arg_harness("dectest0/add0.decTest", "add", [](const auto x, const auto y) { return x + y; });
+    test_two_arg_harness("dectest0/subtract0.decTest", "subtract", [](const auto x, const auto y) { return x - y; });
+    test_two_arg_harness("dectest0/multiply0.decTest", "multiply", [](const auto x, const auto y) { return x * y; });
+    test_two_arg_harness("dectest0/divide0.decTest", "divide", [](const auto x, const auto y) { return x / y; });
+
+    #ifdef BOOST_DECIMAL_DECTEST_STATIC_CHECKS
+    test_static_checks();
+    #endif
+
+    return boost::report_errors();
+}
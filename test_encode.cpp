@@ -0,0 +1,153 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Checks to_dpd and from_dpd against the encodings of dsEncode, ddEncode and dqEncode.
+// Each "apply" case either encodes a number (1.5 -> #...), decodes an encoding (#... -> 1.5),
+// or canonicalizes one (#... -> #...), which is checked as a decode followed by an encode.
+//
+// The decTest encodings keep the exponent of the operand. Where the library picks another member
+// of the same cohort, or drops a NaN payload, both its encoding and the expected one still have to decode
+// to the same value; such cases are counted and reported but do not fail
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_encode.hpp"
+
+using namespace boost::decimal;
+
+struct encode_totals
+{
+    std::size_t exact {};
+    std::size_t same_value {};
+    std::size_t decoded {};
+    std::size_t invalid {};
+};
+
+// Same class, sign and value, the cohort and NaN payload are not compared
+template <typename T>
+bool same_value(const T lhs, const T rhs)
+{
+    if (isnan(lhs) || isnan(rhs))
+    {
+        return isnan(lhs) && isnan(rhs) && issignaling(lhs) == issignaling(rhs) && signbit(lhs) == signbit(rhs);
+    }
+
+    return lhs == rhs && signbit(lhs) == signbit(rhs);
+}
+
+template <typename T>
+void check_encoding(const dectest::test_case& tc, const T value, const dectest::encoded_operand& expected, encode_totals& totals)
+{
+    const auto bits {dectest::dpd_of(value)};
+    if (bits.high == expected.high && bits.low == expected.low)
+    {
+        ++totals.exact;
+    }
+    else if (BOOST_TEST(same_value(dectest::from_encoded<T>(bits), value)) &&
+             BOOST_TEST(same_value(dectest::from_encoded<T>(expected), value)))
+    {
+        ++totals.same_value;
+    }
+    else
+    {
+        std::cerr << "Failed test: " << tc.id << " (" << tc.operands[0] << " -> " << tc.result << ")\n"
+                  << "Got: " << bits << std::endl;
+    }
+}
+
+template <typename T>
+void check_case(const dectest::test_case& tc, const std::size_t digits, encode_totals& totals)
+{
+    dectest::encoded_operand operand {};
+    dectest::encoded_operand result {};
+    const auto operand_encoded {dectest::parse_encoded(tc.operands[0], operand)};
+    const auto result_encoded {dectest::parse_encoded(tc.result, result)};
+
+    if ((operand_encoded && operand.digits != digits) || (result_encoded && result.digits != digits) ||
+        (!operand_encoded && !result_encoded))
+    {
+        // Another format, or a number to number case that is not about the encoding
+        ++totals.invalid;
+        return;
+    }
+
+    try
+    {
+        const auto value {operand_encoded ? dectest::from_encoded<T>(operand) : dectest::make_decimal<T>(tc.operands[0])};
+
+        if (result_encoded)
+        {
+            check_encoding(tc, value, result, totals);
+        }
+        else
+        {
+            const auto expected {dectest::make_decimal<T>(tc.result)};
+            if (!BOOST_TEST(same_value(value, expected)))
+            {
+                std::cerr << "Failed test: " << tc.id << " (" << tc.operands[0] << " -> " << tc.result << ")\n"
+                          << "Got: " << value << std::endl;
+            }
+
+            ++totals.decoded;
+        }
+    }
+    catch (const dectest::invalid_operand&)
+    {
+        // e.g. NaN payloads, which the string conversions do not take
+        ++totals.invalid;
+    }
+}
+
+void test_encode_file(const std::string& file_path)
+{
+    encode_totals totals;
+    std::size_t num_tests_found {};
+
+    const auto found {dectest::for_each_case(file_path, "apply", [&](const dectest::test_case& tc)
+    {
+        ++num_tests_found;
+
+        if ((tc.flags & dectest::case_flags::malformed) != 0U || tc.operand_count != 1U)
+        {
+            ++totals.invalid;
+        }
+        else
+        {
+            switch (dectest::detail::width_of(tc.ctx.precision))
+            {
+                case 32:
+                    check_case<decimal32_t>(tc, 8U, totals);
+                    break;
+                case 64:
+                    check_case<decimal64_t>(tc, 16U, totals);
+                    break;
+                default:
+                    check_case<decimal128_t>(tc, 32U, totals);
+                    break;
+            }
+        }
+    })};
+
+    BOOST_TEST(found);
+
+    std::cerr << file_path << ": " << num_tests_found << " tests, " << totals.exact << " bit exact encodings, "
+              << totals.same_value << " encodings of the same value with another exponent or payload, "
+              << totals.decoded << " decodings, " << totals.invalid << " not applicable\n" << std::endl;
+
+    BOOST_TEST_GT(totals.exact, 0U);
+    BOOST_TEST_GT(totals.decoded, 0U);
+    BOOST_TEST_LT(totals.invalid, num_tests_found);
+}
+
+int main()
+{
+    std::cerr << std::setprecision(std::numeric_limits<decimal128_t>::max_digits10);
+
+    test_encode_file("archive/dectest/dsEncode.decTest");
+    test_encode_file("archive/dectest/ddEncode.decTest");
+    test_encode_file("archive/dectest/dqEncode.decTest");
+
+    return boost::report_errors();
+}
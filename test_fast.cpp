@@ -0,0 +1,146 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Runs the vectors through both the IEEE layout types and the matching decimal_fast*_t
+// and checks that the two agree. The expected results are not looked at, the serial tests do that
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+
+using namespace boost::decimal;
+
+struct differential_totals
+{
+    std::size_t compared {};
+    std::size_t not_comparable {};
+};
+
+template <typename Function>
+class differential_handler final : public dectest::op_handler
+{
+public:
+    differential_handler(Function f, differential_totals& totals) : f_ {std::move(f)}, totals_ {totals} {}
+
+    std::size_t arity() const noexcept override { return 2U; }
+
+    void evaluate(const dectest::test_case& tc) override
+    {
+        try
+        {
+            switch (dectest::detail::width_of(tc.ctx.precision))
+            {
+                case 32:
+                    compare<decimal32_t, decimal_fast32_t>(tc);
+                    break;
+                case 64:
+                    compare<decimal64_t, decimal_fast64_t>(tc);
+                    break;
+                default:
+                    compare<decimal128_t, decimal_fast128_t>(tc);
+                    break;
+            }
+        }
+        catch (...)
+        {
+            dectest::detail::current_outcome().invalid = true;
+        }
+    }
+
+private:
+    template <typename IEEE, typename Fast>
+    void compare(const dectest::test_case& tc)
+    {
+        const auto lhs {dectest::make_decimal<IEEE>(tc.operands[0])};
+        const auto rhs {dectest::make_decimal<IEEE>(tc.operands[1])};
+        const auto fast_lhs {dectest::make_decimal<Fast>(tc.operands[0])};
+        const auto fast_rhs {dectest::make_decimal<Fast>(tc.operands[1])};
+
+        const auto res {f_(lhs, rhs)};
+        const auto fast_res {static_cast<IEEE>(f_(fast_lhs, fast_rhs))};
+
+        // The fast types normalize their significand, so they have no subnormals,
+        // and do not promise the same overflow threshold
+        if (issubnormal(lhs) || issubnormal(rhs) || issubnormal(res) || (isinf(res) && isfinite(lhs) && isfinite(rhs)))
+        {
+            ++totals_.not_comparable;
+            return;
+        }
+
+        ++totals_.compared;
+
+        if (isnan(res))
+        {
+            if (!BOOST_DECIMAL_DECTEST_CHECK(isnan(fast_res)))
+            {
+                std::cerr << "Fast type mismatch: " << tc.id << " (precision: " << tc.ctx.precision << ")" << std::endl;
+            }
+        }
+        else if (!BOOST_DECIMAL_DECTEST_CHECK(res == fast_res && signbit(res) == signbit(fast_res)))
+        {
+            std::cerr << "Fast type mismatch: " << tc.id << " (precision: " << tc.ctx.precision << ")\n"
+                      << "IEEE: " << res << "\nFast: " << fast_res << std::endl;
+        }
+    }
+
+    Function f_;
+    differential_totals& totals_;
+};
+
+template <typename Function>
+std::unique_ptr<dectest::op_handler> make_differential(Function f, differential_totals& totals)
+{
+    return std::unique_ptr<dectest::op_handler>(new differential_handler<Function>(std::move(f), totals));
+}
+
+void run_differential(const bool allow_rounding_changes, const std::vector<std::string>& files)
+{
+    differential_totals totals;
+
+    dectest::dectest_runner runner {allow_rounding_changes};
+    runner.add("add", make_differential([](const auto x, const auto y) { return x + y; }, totals))
+          .add("subtract", make_differential([](const auto x, const auto y) { return x - y; }, totals))
+          .add("multiply", make_differential([](const auto x, const auto y) { return x * y; }, totals))
+          .add("divide", make_differential([](const auto x, const auto y) { return x / y; }, totals));
+
+    for (const auto& file : files)
+    {
+        runner.run(file);
+    }
+
+    std::cerr << "Compared " << totals.compared << " results of the IEEE and fast types, "
+              << totals.not_comparable << " subnormal or overflowing cases were left out\n" << std::endl;
+
+    BOOST_TEST_GT(totals.compared, 0U);
+}
+
+int main()
+{
+    std::cerr << std::setprecision(std::numeric_limits<decimal128_t>::max_digits10);
+
+    run_differential(false, {"dectest0/add0.decTest",
+                             "dectest0/subtract0.decTest",
+                             "dectest0/multiply0.decTest",
+                             "dectest0/divide0.decTest",
+                             "dectest0/inexact0.decTest"});
+
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+
+    boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_default);
+
+    run_differential(true, {"dectest/ddAdd.decTest",
+                            "dectest/dqAdd.decTest",
+                            "dectest/ddSubtract.decTest",
+                            "dectest/dqSubtract.decTest",
+                            "dectest/ddMultiply.decTest",
+                            "dectest/dqMultiply.decTest",
+                            "dectest/ddDivide.decTest",
+                            "dectest/dqDivide.decTest"});
+
+    boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_default);
+
+    #endif // BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+
+    return boost::report_errors();
+}
@@ -0,0 +1,176 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Formats the result of every toSci case with to_chars, snprintf and operator<<
+// and checks the output against the expected decTest string.
+//
+// The library does not write the decTest notation (e.g. 1.23E+5, Infinity), so an output passes
+// when it reads back as the value of the expected string. Outputs that are identical to it are counted
+// per format to show how close each one is to the canonical form
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include <sstream>
+
+using namespace boost::decimal;
+
+enum format_kind : std::size_t
+{
+    scientific_format,
+    general_format,
+    fixed_format,
+    printf_format,
+    stream_format,
+    format_count
+};
+
+constexpr const char* format_names[format_count] {"to_chars scientific", "to_chars general", "to_chars fixed", "snprintf", "operator<<"};
+
+struct format_totals
+{
+    std::size_t cases {};
+    std::size_t not_representable {};
+    std::size_t round_trip[format_count] {};
+    std::size_t identical[format_count] {};
+};
+
+inline const char* printf_format_string(decimal32_t) noexcept { return "%.7Hg"; }
+inline const char* printf_format_string(decimal64_t) noexcept { return "%.16Dg"; }
+inline const char* printf_format_string(decimal128_t) noexcept { return "%.34DDg"; }
+
+template <typename T>
+std::string format(const T value, const format_kind kind)
+{
+    // Fixed notation of the largest decimal128_t has over 6000 digits
+    char buffer[8192] {};
+
+    switch (kind)
+    {
+        case scientific_format:
+        case general_format:
+        case fixed_format:
+        {
+            const auto fmt {kind == scientific_format ? chars_format::scientific : kind == general_format ? chars_format::general : chars_format::fixed};
+            const auto r {to_chars(buffer, buffer + sizeof(buffer), value, fmt)};
+            return r.ec == std::errc() ? std::string(buffer, r.ptr) : std::string();
+        }
+        case printf_format:
+        {
+            const auto written {boost::decimal::snprintf(buffer, sizeof(buffer), printf_format_string(value), value)};
+            return written > 0 ? std::string(buffer, static_cast<std::size_t>(written)) : std::string();
+        }
+        default:
+        {
+            std::ostringstream os;
+            os << std::setprecision(std::numeric_limits<T>::max_digits10) << value;
+            return os.str();
+        }
+    }
+}
+
+// Same class, sign and value
+template <typename T>
+bool same_value(const T lhs, const T rhs)
+{
+    if (isnan(lhs) || isnan(rhs))
+    {
+        return isnan(lhs) && isnan(rhs) && signbit(lhs) == signbit(rhs);
+    }
+
+    return lhs == rhs && signbit(lhs) == signbit(rhs);
+}
+
+template <typename T>
+void check_case(const dectest::test_case& tc, format_totals& totals)
+{
+    T value;
+    T expected;
+    try
+    {
+        value = dectest::make_decimal<T>(tc.operands[0]);
+        expected = dectest::make_decimal<T>(tc.result);
+    }
+    catch (const dectest::invalid_operand&)
+    {
+        // Conversion syntax tests have no value to format
+        return;
+    }
+
+    ++totals.cases;
+
+    // A result rounded to the precision of the file may not be the value of the operand in T
+    if (!same_value(value, expected))
+    {
+        ++totals.not_representable;
+        return;
+    }
+
+    for (std::size_t kind {}; kind < format_count; ++kind)
+    {
+        const auto str {format(value, static_cast<format_kind>(kind))};
+
+        T parsed;
+        const auto r {from_chars(str.data(), str.data() + str.size(), parsed)};
+        if (BOOST_TEST(!str.empty() && r.ec == std::errc() && r.ptr == str.data() + str.size() && same_value(parsed, expected)))
+        {
+            ++totals.round_trip[kind];
+        }
+        else
+        {
+            std::cerr << "Failed test: " << tc.id << " (" << format_names[kind] << ")\n"
+                      << "Got: " << str << "\nExpected: " << tc.result << std::endl;
+        }
+
+        if (str == tc.result)
+        {
+            ++totals.identical[kind];
+        }
+    }
+}
+
+void test_format_file(const std::string& file_path)
+{
+    format_totals totals;
+
+    const auto found {dectest::for_each_case(file_path, "toSci", [&](const dectest::test_case& tc)
+    {
+        if (tc.flags != 0U || tc.operand_count != 1U)
+        {
+            return;
+        }
+
+        switch (dectest::detail::width_of(tc.ctx.precision))
+        {
+            case 32:
+                check_case<decimal32_t>(tc, totals);
+                break;
+            case 64:
+                check_case<decimal64_t>(tc, totals);
+                break;
+            default:
+                check_case<decimal128_t>(tc, totals);
+                break;
+        }
+    })};
+
+    BOOST_TEST(found);
+    BOOST_TEST_GT(totals.cases, 0U);
+
+    std::cerr << file_path << ": " << totals.cases << " values, " << totals.not_representable << " not representable\n";
+    for (std::size_t kind {}; kind < format_count; ++kind)
+    {
+        std::cerr << "  " << std::left << std::setw(22) << format_names[kind] << std::right
+                  << totals.round_trip[kind] << " read back, " << totals.identical[kind] << " identical to toSci\n";
+    }
+    std::cerr << std::endl;
+}
+
+int main()
+{
+    test_format_file("dectest0/base0.decTest");
+    test_format_file("dectest/base.decTest");
+
+    return boost::report_errors();
+}
@@ -8,6 +8,13 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "where_file.hpp"
+#include "dectest_corpus.hpp"
+#include "dectest_embedded.hpp"
+#include "dectest_latency.hpp"
+#include "dectest_ulp.hpp"
+#include "dectest_shard.hpp"
+#include "dectest_perf.hpp"
+#include "dectest_classes.hpp"
 #include <vector>
 #include <sstream>
 #include <iostream>
@@ -17,25 +24,48 @@
 #include <cstdio>
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <iterator>
 #include <utility>
-
+#include <array>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <system_error>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <thread>
+
+// Exact number of representable values between lhs and rhs, see dectest_ulp.hpp.
+// Zeros of either sign are the same value, NaNs and infinities are at the maximum distance from everything but themselves
 template <typename T>
 std::size_t ulp_distance(T lhs, T rhs) noexcept
 {
-    if (isinf(lhs) && isinf(rhs))
+    if (isnan(lhs) || isnan(rhs))
     {
-        return 0u;
+        return std::numeric_limits<std::size_t>::max();
     }
-    else if (lhs == 0U && rhs == 0U)
+    else if (isinf(lhs) || isinf(rhs))
     {
-        return 0u;
+        return isinf(lhs) && isinf(rhs) && signbit(lhs) == signbit(rhs) ? 0U : std::numeric_limits<std::size_t>::max();
     }
-    else if (isnan(lhs) || isnan(rhs))
+
+    using boost::decimal::dectest::detail::ulp_position;
+    using boost::decimal::dectest::detail::saturate;
+
+    const auto lhs_position {ulp_position(lhs)};
+    const auto rhs_position {ulp_position(rhs)};
+
+    // Across zero the distance is the sum of the distances to zero, which still fits in the significand type
+    if (signbit(lhs) != signbit(rhs))
     {
-        return std::numeric_limits<std::size_t>::max();
+        return saturate(lhs_position + rhs_position);
     }
 
-    return static_cast<std::size_t>(boost::decimal::abs((lhs - rhs) / std::min(lhs, rhs)) / std::numeric_limits<T>::epsilon());
+    return saturate(lhs_position > rhs_position ? lhs_position - rhs_position : rhs_position - lhs_position);
 }
 
 template <typename T, typename U>
@@ -44,1232 +74,1563 @@ std::size_t ulp_distance(T, U) noexcept
     return std::numeric_limits<std::size_t>::max();
 }
 
-template <typename Function>
-void test_one_arg_harness(const std::string& file_path, const std::string& function_name, Function f, const std::size_t ulp_tol = 0U)
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+// Thrown by make_decimal, carries no message so that throwing it does not allocate either
+class invalid_operand : public std::exception
+{
+public:
+    const char* what() const noexcept override { return "Can not construct from invalid string"; }
+};
+
+// Constructs a decimal from a view of the test file without allocating.
+// Like the string constructor this throws for strings that are not valid decimals
+template <typename T>
+T make_decimal(const string_view str)
+{
+    T value;
+    const auto last {str.data() + str.size()};
+    const auto r {boost::decimal::from_chars(str.data(), last, value)};
+    if (r.ec != std::errc() || r.ptr != last)
+    {
+        throw invalid_operand();
+    }
+
+    return value;
+}
+
+namespace detail {
+
+// When texts is not null the text of the file is kept there, so the views of the visited cases outlive the call
+template <typename Visitor>
+bool visit_file(const std::string& file_path, const string_view* op, Visitor& visit, const int depth, std::deque<std::string>* texts = nullptr)
 {
-    const auto full_path {boost::decimal::dectest::where_file(file_path)};
+    // Vectors compiled into this binary need neither the corpus nor the file
+    const auto embedded {embedded_registrar::find(file_path)};
+    if (embedded != nullptr)
+    {
+        for (std::size_t i {}; i < embedded->count; ++i)
+        {
+            const auto& c {embedded->cases[i]};
+            if (op == nullptr || *op == c.op)
+            {
+                visit(to_test_case(c));
+            }
+        }
+
+        return true;
+    }
+
+    const auto cases {op == nullptr ? default_corpus().find(file_path) : default_corpus().find(file_path, *op)};
+    if (!cases.empty())
+    {
+        if (default_corpus().is_current(file_path, where_file(file_path)))
+        {
+            for (const auto c : cases)
+            {
+                visit(c.to_test_case());
+            }
+
+            return true;
+        }
+
+        std::cerr << "The corpus is older than " << file_path << ", reading the text file" << std::endl;
+    }
+
+    const auto full_path {where_file(file_path)};
     if (full_path.empty())
     {
         std::cerr << "Failed to find file: " << file_path << std::endl;
-        BOOST_TEST(false);
-        return;
+        return false;
     }
 
-    std::ifstream in(full_path.c_str());
+    std::ifstream in(full_path.c_str(), std::ios::binary);
     if (!in.is_open())
     {
         std::cerr << "Failed to open file: " << full_path << std::endl;
-        BOOST_TEST(false);
-        return;
+        return false;
+    }
+
+    std::string local_text;
+    std::string& text {texts == nullptr ? local_text : (texts->emplace_back(), texts->back())};
+    text.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+    bool found {true};
+    tokenizer tok {text};
+    record r;
+    while (tok.next(r))
+    {
+        if (r.kind == record_kind::test_case)
+        {
+            if (op == nullptr || r.tc.op == *op)
+            {
+                visit(r.tc);
+            }
+        }
+        else if (r.kind == record_kind::directive && iequals(r.keyword, "dectest") && depth < 8)
+        {
+            // e.g. testall.decTest is a list of "dectest: add" includes of files in the same directory
+            const auto slash {file_path.find_last_of('/')};
+            std::string include {slash == std::string::npos ? std::string() : file_path.substr(0, slash + 1U)};
+            include.append(r.value.data(), r.value.size());
+            include += ".decTest";
+
+            found = visit_file(include, op, visit, depth + 1, texts) && found;
+        }
+    }
+
+    return found;
+}
+
+} // namespace detail
+
+// Calls visit(const test_case&) for each test case of op in file_path, in file order.
+//
+// The cases come from the generated tables if their header was included, then from the precompiled corpus
+// if it has the file, otherwise the file is read into a single buffer and tokenized in place,
+// so no path allocates per line.
+// Returns false if the file can not be found
+template <typename Visitor>
+bool for_each_case(const std::string& file_path, const string_view op, Visitor&& visit)
+{
+    return detail::visit_file(file_path, &op, visit, 0);
+}
+
+// Calls visit(const test_case&) for every test case in file_path whatever its op.
+// Corpus cases arrive grouped by op, text files (and their "dectest:" includes) in file order
+template <typename Visitor>
+bool for_each_case(const std::string& file_path, Visitor&& visit)
+{
+    return detail::visit_file(file_path, nullptr, visit, 0);
+}
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+// Applies a decTest rounding mode to the library
+// Returns false for the modes that we do not support so the caller can skip those tests.
+// down is toward zero and up away from it in decTest, the library has no mode for up, half_down or 05up
+inline bool set_dectest_rounding(const boost::decimal::dectest::rounding mode)
+{
+    using boost::decimal::dectest::rounding;
+
+    switch (mode)
+    {
+        case rounding::unspecified:
+            return true;
+        case rounding::floor:
+            boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_downward);
+            return true;
+        case rounding::ceiling:
+            boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_upward);
+            return true;
+        case rounding::down:
+            boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_toward_zero);
+            return true;
+        case rounding::half_up:
+            boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_to_nearest_from_zero);
+            return true;
+        case rounding::half_even:
+            boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_to_nearest);
+            return true;
+        default:
+            std::cerr << "\nInvalid rounding mode: " << boost::decimal::dectest::rounding_name(mode) << std::endl;
+            return false;
+    }
+}
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+namespace detail {
+
+// What evaluating one test case found on the current thread
+struct case_outcome
+{
+    bool quiet;
+    bool failed;
+    bool invalid;
+    bool repeated; // evaluated again to report a failure, so it is not counted twice
+};
+
+inline case_outcome& current_outcome() noexcept
+{
+    static thread_local case_outcome outcome {};
+    return outcome;
+}
+
+// lightweight_test is not thread safe, so on worker threads a check only records the failure.
+// It still passes so that nothing is printed, and the runner later evaluates the case again on the main thread
+inline bool quiet_check(const bool passed) noexcept
+{
+    if (!passed)
+    {
+        current_outcome().failed = true;
+    }
+
+    return true;
+}
+
+// On the main thread the check reports through lightweight_test, and the failure is recorded as well
+// so that run counts it like run_parallel does
+inline bool recorded_check(const bool passed) noexcept
+{
+    if (!passed)
+    {
+        current_outcome().failed = true;
+    }
+
+    return passed;
+}
+
+} // namespace detail
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+#define BOOST_DECIMAL_DECTEST_CHECK(expr) (::boost::decimal::dectest::detail::current_outcome().quiet ? ::boost::decimal::dectest::detail::quiet_check(static_cast<bool>(expr)) : ::boost::decimal::dectest::detail::recorded_check(BOOST_TEST(expr)))
+#define BOOST_DECIMAL_DECTEST_CHECK_EQ(expr1, expr2) (::boost::decimal::dectest::detail::current_outcome().quiet ? ::boost::decimal::dectest::detail::quiet_check((expr1) == (expr2)) : ::boost::decimal::dectest::detail::recorded_check(BOOST_TEST_EQ(expr1, expr2)))
+#define BOOST_DECIMAL_DECTEST_CHECK_LE(expr1, expr2) (::boost::decimal::dectest::detail::current_outcome().quiet ? ::boost::decimal::dectest::detail::quiet_check((expr1) <= (expr2)) : ::boost::decimal::dectest::detail::recorded_check(BOOST_TEST_LE(expr1, expr2)))
+#define BOOST_DECIMAL_DECTEST_CHECK_GT(expr1, expr2) (::boost::decimal::dectest::detail::current_outcome().quiet ? ::boost::decimal::dectest::detail::quiet_check((expr1) > (expr2)) : ::boost::decimal::dectest::detail::recorded_check(BOOST_TEST_GT(expr1, expr2)))
+#define BOOST_DECIMAL_DECTEST_CHECK_LT(expr1, expr2) (::boost::decimal::dectest::detail::current_outcome().quiet ? ::boost::decimal::dectest::detail::quiet_check((expr1) < (expr2)) : ::boost::decimal::dectest::detail::recorded_check(BOOST_TEST_LT(expr1, expr2)))
+
+namespace boost {
+namespace decimal {
+namespace dectest {
+
+// The counts of a run over all the handlers of a runner
+struct run_totals
+{
+    std::size_t found {};
+    std::size_t failed {};
+    std::size_t invalid {};
+    std::size_t skipped {};
+
+    run_totals& operator+=(const run_totals& other) noexcept
+    {
+        found += other.found;
+        failed += other.failed;
+        invalid += other.invalid;
+        skipped += other.skipped;
+        return *this;
     }
+};
+
+// Checks the test cases of one op. The runner counts and validates the cases,
+// evaluate only sees cases that have arity() operands.
+// Checks go through the BOOST_DECIMAL_DECTEST_CHECK macros and invalid operands are recorded
+// in detail::current_outcome() so that evaluate can run on any thread
+class op_handler
+{
+public:
+    virtual ~op_handler() = default;
+
+    virtual std::size_t arity() const noexcept = 0;
+    virtual void evaluate(const test_case& tc) = 0;
+
+    // Whether tc is for this handler. Cases it does not accept are left to the next
+    // handler of the same op, so one op can have a handler per width
+    virtual bool accepts(const test_case&) const noexcept { return true; }
 
     std::size_t num_tests_found {};
+    std::size_t failed_tests {};
     std::size_t invalid_tests {};
-    std::string line;
-    int current_precision = 16; // Default precision
+    std::size_t skipped_tests {};
 
-    while (std::getline(in, line))
+    // Distances of the cases checked with a ULP tolerance
+    ulp_histogram ulp_errors;
+
+protected:
+    void record_ulp_error(const std::size_t distance) noexcept
     {
-        // Skip commented lines
-        if (line.find("#") != std::string::npos)
+        if (!detail::current_outcome().repeated)
         {
-            continue;
+            ulp_errors.record(distance);
         }
+    }
+};
 
-        // Check for precision specification
-        auto precision_pos = line.find("precision:");
-        if (precision_pos != std::string::npos)
-        {
-            auto precision_start = precision_pos + 10; // Skip "precision:"
+namespace detail {
+
+template <typename T>
+using bits_type = decltype(to_bid(T {}));
+
+template <typename T>
+bits_type<T> bits_of(const T value) noexcept
+{
+    #if defined(__GNUC__) && !defined(__clang__)
+    #  pragma GCC diagnostic push
+    #  pragma GCC diagnostic ignored "-Wclass-memaccess"
+    #endif
+
+    bits_type<T> bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+
+    #ifdef __GNUC__
+    #  pragma GCC diagnostic pop
+    #endif
+}
 
-            // Skip whitespace
-            while (precision_start < line.length() && std::isspace(line[precision_start]))
+template <typename Function, typename T, std::size_t Arity, std::size_t... I>
+T call_with(Function& f, const std::array<T, Arity>& operands, std::index_sequence<I...>)
+{
+    return timed_call(f, operands[I]...);
+}
+
+// operands[i] of tc, or its result for i == 3, as T: decoded from the bits of a case compiled into the binary,
+// otherwise parsed from the string. Throws invalid_operand like make_decimal
+template <typename T>
+T case_value(const test_case& tc, const std::size_t i)
+{
+    T value;
+    if (tc.embedded != nullptr && embedded_value(*tc.embedded, i, value))
+    {
+        return value;
+    }
+
+    return make_decimal<T>(i < 3U ? tc.operands[i] : tc.result);
+}
+
+} // namespace detail
+
+// Checks the cases of an op of Arity operands against f, with a tolerance of ulp_tol when it is not 0.
+// evaluate_as<T> is the whole check for one width: the handlers below only choose which widths
+// they instantiate it for, so a handler of a single width compiles f once
+template <std::size_t Arity, typename Function>
+class function_handler : public op_handler
+{
+public:
+    function_handler(Function f, const std::size_t ulp_tol) : f_ {std::move(f)}, ulp_tol_ {ulp_tol} {}
+
+    std::size_t arity() const noexcept override { return Arity; }
+
+    // A finite result also needs the exponent of the file, for the ops whose result is a quantum (quantize, rescale).
+    // The others compare values only, the library does not keep the cohort that decNumber would give
+    void check_quantum() noexcept { check_quantum_ = true; }
+
+protected:
+    std::size_t ulp_tol() const noexcept { return ulp_tol_; }
+
+    template <typename T>
+    void evaluate_as(const test_case& tc)
+    {
+        const auto test_name {tc.id};
+        const auto current_precision {tc.ctx.precision};
+
+        try
+        {
+            std::array<T, Arity> operands;
+            for (std::size_t i {}; i < Arity; ++i)
             {
-                precision_start++;
+                operands[i] = detail::case_value<T>(tc, i);
             }
 
-            // Extract precision value
-            std::string precision_str;
-            while (precision_start < line.length() && std::isdigit(line[precision_start]))
+            const auto rhs {detail::case_value<T>(tc, 3U)};
+            const auto f_result {detail::call_with(f_, operands, std::make_index_sequence<Arity>())};
+
+            if (nan_compared(operands, rhs))
             {
-                precision_str += line[precision_start++];
+                if (!BOOST_DECIMAL_DECTEST_CHECK_EQ(detail::bits_of(f_result), detail::bits_of(rhs)))
+                {
+                    std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
+                }
             }
-
-            if (!precision_str.empty())
+            else if (ulp_tol_ != 0)
+            {
+                const auto dist {ulp_distance(f_result, rhs)};
+                record_ulp_error(dist);
+                if (!BOOST_DECIMAL_DECTEST_CHECK_LE(dist, ulp_tol_))
+                {
+                    std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << "\n"
+                              << "Got: " << f_result << "\nExpected: " << rhs << std::endl;
+                }
+            }
+            else if (!BOOST_DECIMAL_DECTEST_CHECK_EQ(f_result, rhs))
             {
-                current_precision = std::stoi(precision_str);
+                std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
+            }
+            else if (check_quantum_ && isfinite(rhs) && !BOOST_DECIMAL_DECTEST_CHECK(samequantum(f_result, rhs)))
+            {
+                std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << "\n"
+                          << "Exponent differs, expected the quantum of " << tc.result << std::endl;
             }
-            continue;
         }
+        catch (...)
+        {
+            // Invalid construction is supposed to throw
+            detail::current_outcome().invalid = true;
+        }
+    }
 
-        const auto first_space = line.find(" ");
-        const auto test_name = line.substr(0, first_space);
-
-        // Check if this line contains our function
-        const auto pos_test = line.find(function_name + " ");
-        if (pos_test == std::string::npos)
+private:
+    // NaN results are compared bit for bit, since a NaN does not compare equal to anything.
+    // A one argument op does so when the operand and the result are NaN,
+    // the others when all of the operands or the result are
+    template <typename T>
+    static bool nan_compared(const std::array<T, Arity>& operands, const T rhs) noexcept
+    {
+        bool all_nan {true};
+        for (const auto& operand : operands)
         {
-            continue;
+            all_nan = all_nan && isnan(operand);
         }
 
-        ++num_tests_found;
+        return Arity == 1U ? all_nan && isnan(rhs) : all_nan || isnan(rhs);
+    }
+
+    Function f_;
+    std::size_t ulp_tol_;
+    bool check_quantum_ {};
+};
+
+// Evaluates f in the width that the precision of each case selects
+template <std::size_t Arity, typename Function>
+class any_width_handler final : public function_handler<Arity, Function>
+{
+public:
+    using function_handler<Arity, Function>::function_handler;
 
-        // Find the arrow separator
-        const auto arrow_pos = line.find("->");
-        if (arrow_pos == std::string::npos)
+    void evaluate(const test_case& tc) override
+    {
+        switch (detail::width_of(tc.ctx.precision))
         {
-            std::cerr << "Invalid format: missing '->' in line: " << line << std::endl;
-            ++invalid_tests;
-            continue;
+            case 32:
+                this->template evaluate_as<decimal32_t>(tc);
+                break;
+            case 64:
+                this->template evaluate_as<decimal64_t>(tc);
+                break;
+            default:
+                this->template evaluate_as<decimal128_t>(tc);
+                break;
         }
+    }
+};
+
+template <typename Function>
+using one_arg_handler = any_width_handler<1U, Function>;
+
+template <typename Function>
+using two_arg_handler = any_width_handler<2U, Function>;
+
+// Evaluates f in T only, the cases of other widths are not accepted when the file is read
+template <typename T, std::size_t Arity, typename Function>
+class typed_handler : public function_handler<Arity, Function>
+{
+public:
+    using function_handler<Arity, Function>::function_handler;
+
+    bool accepts(const test_case& tc) const noexcept override
+    {
+        return detail::width_of(tc.ctx.precision) == detail::width_of(std::numeric_limits<T>::digits);
+    }
 
-        // Extract LHS value (between function name and ->)
-        auto lhs_start = pos_test + function_name.length() + 1; // Skip function name and space
-        auto lhs_end = arrow_pos;
+    void evaluate(const test_case& tc) override
+    {
+        this->template evaluate_as<T>(tc);
+    }
+};
 
-        // Trim whitespace and extract value
-        while (lhs_start < lhs_end && std::isspace(line[lhs_start]))
+// Evaluates f in every width whose result the case is a reference for, whatever width its precision selects.
+// With a ULP tolerance that is every case of result_fits_width, whose second rounding is well within it,
+// otherwise only those at the precision of the width, see result_rounded_to_width
+template <std::size_t Arity, typename Function>
+class reference_handler final : public function_handler<Arity, Function>
+{
+public:
+    using function_handler<Arity, Function>::function_handler;
+
+    bool accepts(const test_case& tc) const noexcept override
+    {
+        return reference_for(tc, 32) || reference_for(tc, 64) || reference_for(tc, 128);
+    }
+
+    void evaluate(const test_case& tc) override
+    {
+        if (reference_for(tc, 32))
         {
-            lhs_start++;
+            this->template evaluate_as<decimal32_t>(tc);
         }
-
-        while (lhs_end > lhs_start && std::isspace(line[lhs_end - 1]))
+        if (reference_for(tc, 64))
         {
-            lhs_end--;
+            this->template evaluate_as<decimal64_t>(tc);
         }
-
-        std::string lhs_value = line.substr(lhs_start, lhs_end - lhs_start);
-
-        // Remove quotes if present
-        if (!lhs_value.empty() && lhs_value.front() == '\'' && lhs_value.back() == '\'')
+        if (reference_for(tc, 128))
         {
-            lhs_value = lhs_value.substr(1, lhs_value.length() - 2);
+            this->template evaluate_as<decimal128_t>(tc);
         }
+    }
 
-        // Extract RHS value (after ->)
-        auto rhs_start = arrow_pos + 2; // Skip "->"
-        auto rhs_end = line.length();
+private:
+    bool reference_for(const test_case& tc, const int width) const noexcept
+    {
+        return this->ulp_tol() != 0U ? result_fits_width(tc, width) : result_rounded_to_width(tc, width);
+    }
+};
 
-        // Trim whitespace
-        while (rhs_start < rhs_end && std::isspace(line[rhs_start])) rhs_start++;
-        while (rhs_end > rhs_start && std::isspace(line[rhs_end - 1])) rhs_end--;
+// typed_handler<T, 1> on the cases of one rounding mode of the file, for the functions that round in a fixed
+// way whatever the mode of the library, e.g. floor for the cases under rounding: floor
+template <typename T, typename Function>
+class rounding_handler final : public typed_handler<T, 1U, Function>
+{
+public:
+    rounding_handler(Function f, const rounding round) : typed_handler<T, 1U, Function>(std::move(f), 0U), round_ {round} {}
 
-        std::string rhs_value = line.substr(rhs_start, rhs_end - rhs_start);
+    bool accepts(const test_case& tc) const noexcept override
+    {
+        return tc.ctx.round == round_ && typed_handler<T, 1U, Function>::accepts(tc);
+    }
+
+private:
+    rounding round_;
+};
 
-        // Remove quotes if present
-        if (!rhs_value.empty() && rhs_value.front() == '\'' && rhs_value.back() == '\'')
+// The result of compare is -1, 0 or 1 and not a decimal of the width, so the comparison handlers
+// check it against the relational operators of T
+class comparison_handler final : public op_handler
+{
+public:
+    std::size_t arity() const noexcept override { return 2U; }
+
+    void evaluate(const test_case& tc) override
+    {
+        switch (detail::width_of(tc.ctx.precision))
         {
-            rhs_value = rhs_value.substr(1, rhs_value.length() - 2);
+            case 32:
+                evaluate_as<decimal32_t>(tc);
+                break;
+            case 64:
+                evaluate_as<decimal64_t>(tc);
+                break;
+            default:
+                evaluate_as<decimal128_t>(tc);
+                break;
         }
+    }
+
+private:
+    template <typename T>
+    static void evaluate_as(const test_case& tc)
+    {
+        const auto test_name {tc.id};
+        const auto current_precision {tc.ctx.precision};
+        const auto rhs_value {tc.result};
 
-        // Select appropriate decimal type based on precision
         try
         {
-            if (current_precision <= 9)
-            {
-                // Use decimal32_t
-                const boost::decimal::decimal32_t lhs {lhs_value};
-                const boost::decimal::decimal32_t rhs {rhs_value};
-                const auto f_lhs {f(lhs)};
+            const string_view eq {"0"};
+            const string_view gt {"1"};
+            const string_view lt {"-1"};
 
-                if (isnan(lhs) && isnan(rhs))
-                {
-                    std::uint32_t lhs_bits;
-                    std::memcpy(&lhs_bits, &f_lhs, sizeof(std::uint32_t));
-
-                    std::uint32_t rhs_bits;
-                    std::memcpy(&rhs_bits, &rhs, sizeof(std::uint32_t));
+            const auto lhs1 {detail::case_value<T>(tc, 0U)};
+            const auto lhs2 {detail::case_value<T>(tc, 1U)};
 
-                    if (!BOOST_TEST_EQ(lhs_bits, rhs_bits))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
+            if (rhs_value == eq)
+            {
+                if (!BOOST_DECIMAL_DECTEST_CHECK_EQ(lhs1, lhs2))
+                {
+                    std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
                 }
-                else if (ulp_tol != 0)
+            }
+            else if (rhs_value == gt)
+            {
+                if (!BOOST_DECIMAL_DECTEST_CHECK_GT(lhs1, lhs2))
                 {
-                    const auto dist {ulp_distance(f_lhs, rhs)};
-                    if (!BOOST_TEST_LE(dist, ulp_tol))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << "\n"
-                                  << "Got: " << f_lhs << "\nExpected: " << rhs << std::endl;
-                    }
+                    std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
                 }
-                else if (!BOOST_TEST_EQ(f(lhs), rhs))
+            }
+            else if (rhs_value == lt)
+            {
+                if (!BOOST_DECIMAL_DECTEST_CHECK_LT(lhs1, lhs2))
                 {
                     std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
                 }
             }
-            else if (current_precision <= 16)
+            else
             {
-                // Use decimal64_t
-                const boost::decimal::decimal64_t lhs {lhs_value};
-                const boost::decimal::decimal64_t rhs {rhs_value};
-                const auto f_lhs {f(lhs)};
+                throw std::logic_error("Invalid comparison");
+            }
+        }
+        catch (...)
+        {
+            // Invalid construction is supposed to throw
+            detail::current_outcome().invalid = true;
+        }
+    }
+};
 
-                if (isnan(lhs) && isnan(rhs))
-                {
-                    std::uint64_t lhs_bits;
-                    std::memcpy(&lhs_bits, &f_lhs, sizeof(std::uint64_t));
+class comparetotal_handler final : public op_handler
+{
+public:
+    std::size_t arity() const noexcept override { return 2U; }
 
-                    std::uint64_t rhs_bits;
-                    std::memcpy(&rhs_bits, &rhs, sizeof(std::uint64_t));
+    void evaluate(const test_case& tc) override
+    {
+        switch (detail::width_of(tc.ctx.precision))
+        {
+            case 32:
+                evaluate_as<decimal32_t>(tc);
+                break;
+            case 64:
+                evaluate_as<decimal64_t>(tc);
+                break;
+            default:
+                evaluate_as<decimal128_t>(tc);
+                break;
+        }
+    }
 
-                    if (!BOOST_TEST_EQ(lhs_bits, rhs_bits))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (ulp_tol != 0)
+private:
+    template <typename T>
+    static void evaluate_as(const test_case& tc)
+    {
+        const auto test_name {tc.id};
+        const auto current_precision {tc.ctx.precision};
+        const auto rhs_value {tc.result};
+
+        try
+        {
+            const string_view eq {"0"};
+            const string_view gt {"1"};
+            const string_view lt {"-1"};
+
+            const auto lhs1 {detail::case_value<T>(tc, 0U)};
+            const auto lhs2 {detail::case_value<T>(tc, 1U)};
+
+            if (rhs_value == eq)
+            {
+                if ((isinf(lhs1) && isinf(lhs2) && (signbit(lhs1) == signbit(lhs2))) || (isnan(lhs1) && isnan(lhs2)))
                 {
-                    const auto dist {ulp_distance(f_lhs, rhs)};
-                    if (!BOOST_TEST_LE(dist, ulp_tol))
+                    if (!BOOST_DECIMAL_DECTEST_CHECK(comparetotal(lhs1, lhs2) == comparetotal(lhs2, lhs1)))
                     {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << "\n"
-                                  << "Got: " << f_lhs << "\nExpected: " << rhs << std::endl;
+                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
                     }
                 }
-                else if (!BOOST_TEST_EQ(f(lhs), rhs))
+                else if (!(BOOST_DECIMAL_DECTEST_CHECK(comparetotal(lhs1, lhs2)) && BOOST_DECIMAL_DECTEST_CHECK(comparetotal(lhs2, lhs1))))
                 {
                     std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
                 }
             }
-            else
+            else if (rhs_value == gt)
             {
-                #if defined(__GNUC__) && !defined(__clang__)
-                #  pragma GCC diagnostic push
-                #  pragma GCC diagnostic ignored "-Wclass-memaccess"
-                #  pragma GCC diagnostic ignored "-Wstringop-overread"
-                #endif
-
-                // Use decimal128_t
-                const boost::decimal::decimal128_t lhs {lhs_value};
-                const boost::decimal::decimal128_t rhs {rhs_value};
-                const auto f_lhs {f(lhs)};
-
-                if (isnan(lhs) && isnan(rhs))
+                if (!BOOST_DECIMAL_DECTEST_CHECK(comparetotal(lhs2, lhs1)))
                 {
-                    boost::int128::uint128_t lhs_bits;
-                    std::memcpy(&lhs_bits, &f_lhs, sizeof(boost::int128::uint128_t));
-
-                    boost::int128::uint128_t rhs_bits;
-                    std::memcpy(&rhs_bits, &rhs, sizeof(boost::int128::uint128_t));
-
-                    if (!BOOST_TEST_EQ(lhs_bits, rhs_bits))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (ulp_tol != 0)
-                {
-                    const auto dist {ulp_distance(f_lhs, rhs)};
-                    if (!BOOST_TEST_LE(dist, ulp_tol))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << "\n"
-                                  << "Got: " << f_lhs << "\nExpected: " << rhs << std::endl;
-                    }
+                    std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
                 }
-                else if (!BOOST_TEST_EQ(f(lhs), rhs))
+            }
+            else if (rhs_value == lt)
+            {
+                if (!BOOST_DECIMAL_DECTEST_CHECK(comparetotal(lhs1, lhs2)))
                 {
                     std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
                 }
-                
-                #ifdef __GNUC__
-                #  pragma GCC diagnostic pop
-                #endif
+            }
+            else
+            {
+                throw std::logic_error("Invalid comparison");
             }
         }
         catch (...)
         {
             // Invalid construction is supposed to throw
-            ++invalid_tests;
+            detail::current_outcome().invalid = true;
         }
     }
+};
+
+// Parses a file once and sends each test case to the handler registered for its op.
+//
+// Files such as dectest0/inexact0.decTest and archive/dectest/randoms.decTest mix several ops,
+// registering them all on one runner reads and tokenizes the file a single time instead of once per op.
+// Ops without a handler are ignored.
+//
+// The library rounding mode is global, so with allow_rounding_changes the runner follows the
+// rounding: directives for all handlers and skips the cases of modes we do not support.
+// run collects the cases of the file first and groups them into batches of one op, rounding mode and precision
+// (and so one width). The mode is set once per batch rather than at every directive, each batch is timed,
+// and the rounding mode of the caller is restored at the end.
+//
+// run_parallel spreads the cases of many files over worker threads. Since the rounding mode can not be
+// made per thread the cases are run in one phase per rounding mode: the mode is set while the workers
+// are stopped and every worker of the phase evaluates under it. Failures are reported afterwards
+// from the calling thread in file order, so the output does not depend on the scheduling
+class dectest_runner
+{
+public:
+    explicit dectest_runner(const bool allow_rounding_changes = false) noexcept : allow_rounding_changes_ {allow_rounding_changes} {}
 
-    BOOST_TEST_GT(num_tests_found, 0U);
-    BOOST_TEST_LT(invalid_tests, num_tests_found);
-}
+    template <typename Function>
+    dectest_runner& add_one_arg(std::string op, Function f, const std::size_t ulp_tol = 0U)
+    {
+        return add(std::move(op), std::unique_ptr<op_handler>(new one_arg_handler<Function>(std::move(f), ulp_tol)));
+    }
 
-template <bool allow_rounding_changes = false, typename Function = std::minus<>()>
-void test_two_arg_harness(const std::string& file_path, const std::string& function_name, Function f, const std::size_t ulp_tol = 0)
-{
-    const auto full_path {boost::decimal::dectest::where_file(file_path)};
-    if (full_path.empty())
+    template <typename Function>
+    dectest_runner& add_two_arg(std::string op, Function f, const std::size_t ulp_tol = 0U)
     {
-        std::cerr << "Failed to find file: " << file_path << std::endl;
-        BOOST_TEST(false);
-        return;
+        return add(std::move(op), std::unique_ptr<op_handler>(new two_arg_handler<Function>(std::move(f), ulp_tol)));
     }
 
-    std::ifstream in(full_path.c_str());
-    if (!in.is_open())
+    // f(T...) with Arity operands for the cases whose precision selects T. Only that instantiation of f is compiled,
+    // so a file of a single width, or one typed op per width, costs a third of add_one_arg or add_two_arg
+    template <typename T, std::size_t Arity, typename Function>
+    dectest_runner& add_typed(std::string op, Function f, const std::size_t ulp_tol = 0U)
     {
-        std::cerr << "Failed to open file: " << full_path << std::endl;
-        BOOST_TEST(false);
-        return;
+        return add(std::move(op), std::unique_ptr<op_handler>(new typed_handler<T, Arity, Function>(std::move(f), ulp_tol)));
     }
 
-    std::size_t num_tests_found {};
-    std::size_t invalid_tests {};
-    std::string line;
-    int current_precision = 16;
-    bool skip = false;
-    BOOST_DECIMAL_ATTRIBUTE_UNUSED unsigned skip_counter {};
-    BOOST_DECIMAL_ATTRIBUTE_UNUSED unsigned total_skipped_tests {};
+    // f in each width on the cases whose result is a reference for it, the other cases of op are neither counted nor run.
+    // For the files of the functions, which go to precisions and exponents that no width has, see reference_handler
+    template <std::size_t Arity, typename Function>
+    dectest_runner& add_reference(std::string op, Function f, const std::size_t ulp_tol = 0U)
+    {
+        return add(std::move(op), std::unique_ptr<op_handler>(new reference_handler<Arity, Function>(std::move(f), ulp_tol)));
+    }
+
+    // add_typed<T, 2> for the ops whose result is a quantum, e.g. quantize: a finite result has to have
+    // the exponent of the file as well as its value
+    template <typename T, typename Function>
+    dectest_runner& add_quantum(std::string op, Function f)
+    {
+        std::unique_ptr<typed_handler<T, 2U, Function>> handler {new typed_handler<T, 2U, Function>(std::move(f), 0U)};
+        handler->check_quantum();
+        return add(std::move(op), std::move(handler));
+    }
+
+    // f on the cases of op in T whose rounding mode is round
+    template <typename T, typename Function>
+    dectest_runner& add_rounded(std::string op, const rounding round, Function f)
+    {
+        return add(std::move(op), std::unique_ptr<op_handler>(new rounding_handler<T, Function>(std::move(f), round)));
+    }
 
-    while (std::getline(in, line))
+    // tointegral and tointegralx through the function of the library for each rounding mode of the file.
+    // nearbyint and rint round in the mode of the library, which is half_even unless the runner changes it,
+    // and rint is the one that signals inexact as tointegralx does.
+    // up, half_down and 05up have no function, their cases are not accepted
+    template <typename T>
+    dectest_runner& add_to_integral(const std::string& op)
     {
-        // Skip commented lines
-        if (line.find("#") != std::string::npos)
+        if (op == "tointegralx")
         {
-            continue;
+            add_rounded<T>(op, rounding::half_even, [](const T x) { return rint(x); });
         }
+        else
+        {
+            add_rounded<T>(op, rounding::half_even, [](const T x) { return nearbyint(x); });
+        }
+
+        add_rounded<T>(op, rounding::half_up, [](const T x) { return round(x); });
+        add_rounded<T>(op, rounding::down, [](const T x) { return trunc(x); });
+        add_rounded<T>(op, rounding::floor, [](const T x) { return floor(x); });
+        return add_rounded<T>(op, rounding::ceiling, [](const T x) { return ceil(x); });
+    }
+
+    dectest_runner& add_comparisons(std::string op)
+    {
+        return add(std::move(op), std::unique_ptr<op_handler>(new comparison_handler()));
+    }
+
+    dectest_runner& add_comparetotal(std::string op)
+    {
+        return add(std::move(op), std::unique_ptr<op_handler>(new comparetotal_handler()));
+    }
+
+    dectest_runner& add(std::string op, std::unique_ptr<op_handler> handler)
+    {
+        handlers_.emplace_back(std::move(op), std::move(handler));
+        return *this;
+    }
+
+    // Only the cases of the registered ops for which keep(tc) is true are counted and evaluated,
+    // e.g. the cases of one width or an id range. With a selection a file may have no case to run
+    dectest_runner& select(std::function<bool(const test_case&)> keep)
+    {
+        keep_ = std::move(keep);
+        return *this;
+    }
+
+    // Only the cases for which reference(tc) is true belong to the file, e.g. the cases of registered_files
+    // that are a reference for the library. Unlike select the run stays complete, so an op left without cases still fails
+    dectest_runner& restrict_to(std::function<bool(const test_case&)> reference)
+    {
+        reference_ = std::move(reference);
+        return *this;
+    }
+
+    // Only evaluates the cases of shard.index out of shard.count, see dectest_shard.hpp.
+    // The default is $BOOST_DECIMAL_DECTEST_SHARD
+    dectest_runner& shard(const shard_spec& shard) noexcept
+    {
+        shard_ = shard;
+        return *this;
+    }
+
+    // Appends the totals and failed ids of each run to path, for dectest_merge. An empty path turns it off.
+    // The default is $BOOST_DECIMAL_DECTEST_RESULTS
+    dectest_runner& record_results(std::string path)
+    {
+        results_path_ = std::move(path);
+        return *this;
+    }
 
-        // Check for precision specification
-        // When the precision is specified we ust that one until it is specified again
-        // Some of these test sets assume precisions we don't offer so this is the best effort
-        auto precision_pos = line.find("precision:");
-        if (precision_pos != std::string::npos)
+    // Counts instructions, cycles, branch and L1d misses of each batch of run() with the hardware counters,
+    // see dectest_perf.hpp. The default is $BOOST_DECIMAL_DECTEST_PERF. run_parallel does not count anything
+    dectest_runner& record_perf(const bool enabled) noexcept
+    {
+        perf_ = enabled;
+        return *this;
+    }
+
+    // Times every call of the tested functions in run() and prints a histogram and the top slowest ids of each file.
+    // 0 turns it off. The default is $BOOST_DECIMAL_DECTEST_LATENCY.
+    // run_parallel does not time anything, the threads would disturb each other's measurements
+    dectest_runner& record_latency(const std::size_t top) noexcept
+    {
+        latency_top_ = top;
+        return *this;
+    }
+
+    // Runs every registered op over file_path and reports the totals of each
+    void run(const std::string& file_path)
+    {
+        reset();
+
+        std::unique_ptr<latency_report> latency;
+        if (latency_top_ > 0U)
         {
-            auto precision_start = precision_pos + 10; // Skip "precision:"
+            latency.reset(new latency_report(latency_top_));
+        }
+
+        // The views of the cases stay valid as long as texts
+        std::deque<std::string> texts;
+        std::vector<job> jobs;
+        std::vector<batch> batches;
 
-            // Skip whitespace
-            while (precision_start < line.length() && std::isspace(line[precision_start]))
+        const auto collect = [&](const test_case& tc)
+        {
+            const auto handler {accept(tc)};
+            if (handler == nullptr)
             {
-                precision_start++;
+                return;
             }
 
-            // Extract precision value
-            std::string precision_str;
-            while (precision_start < line.length() && std::isdigit(line[precision_start]))
+            const auto round {allow_rounding_changes_ ? tc.ctx.round : rounding::unspecified};
+            auto found_batch {std::find_if(batches.begin(), batches.end(), [&](const batch& b)
             {
-                precision_str += line[precision_start++];
-            }
+                return b.handler == handler && b.round == round && b.precision == tc.ctx.precision;
+            })};
 
-            if (!precision_str.empty())
+            if (found_batch == batches.end())
             {
-                current_precision = std::stoi(precision_str);
+                batches.push_back(batch {tc.op, handler, round, tc.ctx.precision, {}, {}, false, {}});
+                found_batch = batches.end() - 1;
             }
-            continue;
+
+            found_batch->cases.push_back(jobs.size());
+            jobs.push_back(job {tc, handler, round, result::passed, 0U});
+        };
+
+        // With a single op the corpus can hand us just its range
+        const auto op {single_op()};
+        if (!detail::visit_file(file_path, op.empty() ? nullptr : &op, collect, 0, &texts))
+        {
+            BOOST_TEST(false);
+            return;
         }
 
-        // Check for rounding mode changes
-        BOOST_DECIMAL_IF_CONSTEXPR (allow_rounding_changes)
+        latency_ = latency.get();
+        detail::latency_enabled() = latency_ != nullptr;
+
+        std::unique_ptr<perf_counters> counters;
+        if (perf_)
         {
-            auto rounding_pos = line.find("rounding:");
-            if (rounding_pos != std::string::npos)
+            counters.reset(new perf_counters());
+            if (!counters->available())
             {
-                auto rounding_start = rounding_pos + 10;
-                auto rounding_end = line.length();
+                std::cerr << "Hardware counters are not available, see /proc/sys/kernel/perf_event_paranoid" << std::endl;
+                counters.reset();
+            }
+        }
 
-                while (rounding_start < line.length() && std::isspace(line[rounding_start]))
+        const auto entry_round {boost::decimal::fegetround()};
+        for (auto& b : batches)
+        {
+            if (!apply_rounding(b.round, entry_round))
+            {
+                // Testing of unsupported rounding modes should be completely skipped
+                std::cerr << "Skipped: " << b.cases.size() << " due to invalid rounding mode.\n" << std::endl;
+                b.handler->skipped_tests += b.cases.size();
+                b.skipped = true;
+                for (const auto i : b.cases)
                 {
-                    rounding_start++;
+                    jobs[i].outcome = result::skipped;
                 }
 
-                // Extract the rounding mode
-                const std::string rounding_str {line.substr(rounding_start, rounding_end - rounding_start - 1u)};
+                continue;
+            }
 
-                if (rounding_str == "floor" || rounding_str == "down")
-                {
-                    boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_downward);
-                    skip = false;
-                }
-                else if (rounding_str == "ceiling" || rounding_str == "up")
-                {
-                    boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_upward);
-                    skip = false;
-                }
-                else if (rounding_str == "half_up")
+            if (counters != nullptr)
+            {
+                counters->start();
+            }
+
+            const auto start {std::chrono::steady_clock::now()};
+
+            for (const auto i : b.cases)
+            {
+                auto& j {jobs[i]};
+                detail::last_latency() = 0U;
+
+                j.outcome = evaluate_case(*j.handler, j.tc);
+                if (j.outcome == result::invalid)
                 {
-                    boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_to_nearest_from_zero);
-                    skip = false;
+                    ++j.handler->invalid_tests;
                 }
-                else if (rounding_str == "half_even")
+                else if (j.outcome == result::failed)
                 {
-                    boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_to_nearest);
-                    skip = false;
+                    ++j.handler->failed_tests;
                 }
-                else
+                else if (latency_ != nullptr && detail::last_latency() != 0U)
                 {
-                    std::cerr << "\nInvalid rounding mode: " << rounding_str << std::endl;
-                    skip = true;
+                    latency_->record(j.tc, detail::last_latency());
                 }
+            }
 
-                if (!skip && skip_counter > 0U)
-                {
-                    std::cerr << "Skipped: " << skip_counter << " due to invalid rounding mode.\n" << std::endl;
-                    num_tests_found += skip_counter;
-                    total_skipped_tests += skip_counter;
-                    skip_counter = 0U;
-                }
+            b.elapsed = std::chrono::steady_clock::now() - start;
 
-                continue;
+            if (counters != nullptr)
+            {
+                b.counters = counters->stop();
             }
         }
 
-        if (skip)
-        {
-            // Testing of unsupported rounding modes should be completely skipped
-            ++skip_counter;
-            continue;
-        }
+        boost::decimal::fesetround(entry_round);
 
-        const auto first_space = line.find(" ");
-        const auto test_name = line.substr(0, first_space);
+        detail::latency_enabled() = false;
+        latency_ = nullptr;
 
-        // Check if this line contains our function
-        const auto pos_test = line.find(function_name + " ");
-        if (pos_test == std::string::npos)
+        if (latency != nullptr)
         {
-            continue;
+            latency->print(file_path);
         }
 
-        ++num_tests_found;
+        print_batches(file_path, batches);
+        report(file_path);
 
-        // Find the arrow separator
-        const auto arrow_pos = line.find("->");
-        if (arrow_pos == std::string::npos)
+        if (!results_path_.empty())
         {
-            std::cerr << "Invalid format: missing '->' in line: " << line << std::endl;
-            ++invalid_tests;
-            continue;
-        }
+            std::vector<std::chrono::steady_clock::duration> elapsed(handlers_.size());
+            for (const auto& b : batches)
+            {
+                elapsed[handler_index(b.handler)] += b.elapsed;
+            }
 
-        // Extract the substring containing both LHS values
-        auto operands_start = pos_test + function_name.length() + 1;
-        auto operands_end = arrow_pos;
+            write_results(std::vector<std::string> {file_path}, jobs, elapsed);
+        }
+    }
 
-        // Trim trailing whitespace
-        while (operands_end > operands_start && std::isspace(line[operands_end - 1]))
+    // The counts of the last run or run_parallel
+    run_totals totals() const noexcept
+    {
+        run_totals t;
+        for (const auto& entry : handlers_)
         {
-            operands_end--;
+            t.found += entry.second->num_tests_found;
+            t.failed += entry.second->failed_tests;
+            t.invalid += entry.second->invalid_tests;
+            t.skipped += entry.second->skipped_tests;
         }
 
-        std::string operands_str = line.substr(operands_start, operands_end - operands_start);
+        return t;
+    }
 
-        // Parse the two operands from the string
-        std::string lhs1_value, lhs2_value;
-        std::size_t i = 0;
+    // Runs every registered op over all of file_paths on threads workers, or on
+    // $BOOST_DECIMAL_DECTEST_THREADS / all hardware threads when threads is 0
+    void run_parallel(const std::vector<std::string>& file_paths, std::size_t threads = 0U)
+    {
+        reset();
 
-        // Skip leading whitespace
-        while (i < operands_str.length() && std::isspace(operands_str[i]))
+        if (threads == 0U)
         {
-            i++;
+            threads = default_thread_count();
         }
 
-        // Parse first operand
-        if (i < operands_str.length() && operands_str[i] == '\'')
+        // Collect the cases of all the files first, the views stay valid as long as texts
+        std::deque<std::string> texts;
+        std::vector<job> jobs;
+        std::vector<rounding> modes;
+        std::size_t file_index {};
+
+        const auto collect = [&](const test_case& tc)
         {
-            // Quoted value
-            i++; // Skip opening quote
-            std::size_t quote_end = operands_str.find('\'', i);
-            if (quote_end != std::string::npos)
+            const auto handler {accept(tc)};
+            if (handler == nullptr)
             {
-                lhs1_value = operands_str.substr(i, quote_end - i);
-                i = quote_end + 1;
+                return;
             }
-        }
-        else
-        {
-            // Unquoted value
-            std::size_t start = i;
-            while (i < operands_str.length() && !std::isspace(operands_str[i]))
+
+            const auto round {allow_rounding_changes_ ? tc.ctx.round : rounding::unspecified};
+            if (std::find(modes.begin(), modes.end(), round) == modes.end())
             {
-                i++;
+                modes.push_back(round);
             }
-            lhs1_value = operands_str.substr(start, i - start);
-        }
 
-        // Skip whitespace between operands
-        while (i < operands_str.length() && std::isspace(operands_str[i]))
-        {
-            i++;
-        }
+            jobs.push_back(job {tc, handler, round, result::passed, file_index});
+        };
 
-        // Parse second operand
-        if (i < operands_str.length() && operands_str[i] == '\'')
+        for (const auto& file_path : file_paths)
         {
-            // Quoted value
-            i++; // Skip opening quote
-            std::size_t quote_end = operands_str.find('\'', i);
-            if (quote_end != std::string::npos)
+            file_index = static_cast<std::size_t>(&file_path - file_paths.data());
+            const auto op {single_op()};
+            if (!detail::visit_file(file_path, op.empty() ? nullptr : &op, collect, 0, &texts))
             {
-                lhs2_value = operands_str.substr(i, quote_end - i);
-                i = quote_end + 1;
+                BOOST_TEST(false);
             }
         }
-        else
+
+        const auto entry_round {boost::decimal::fegetround()};
+        const auto start {std::chrono::steady_clock::now()};
+        std::chrono::steady_clock::duration busy {};
+
+        std::vector<std::size_t> phase;
+        for (const auto mode : modes)
         {
-            // Unquoted value
-            std::size_t start = i;
-            while (i < operands_str.length() && !std::isspace(operands_str[i]))
+            phase.clear();
+            for (std::size_t i {}; i < jobs.size(); ++i)
             {
-                i++;
+                if (jobs[i].round == mode)
+                {
+                    phase.push_back(i);
+                }
             }
-            lhs2_value = operands_str.substr(start, i - start);
-        }
-
-        // Extract RHS value (after ->)
-        auto rhs_start = arrow_pos + 2; // Skip "->"
-        auto rhs_end = line.length();
 
-        // Trim whitespace
-        while (rhs_start < rhs_end && std::isspace(line[rhs_start]))
-        {
-            rhs_start++;
-        }
-        while (rhs_end > rhs_start && std::isspace(line[rhs_end - 1]))
-        {
-            rhs_end--;
-        }
+            if (!apply_rounding(mode, entry_round))
+            {
+                std::cerr << "Skipped: " << phase.size() << " due to invalid rounding mode.\n" << std::endl;
+                for (const auto i : phase)
+                {
+                    ++jobs[i].handler->skipped_tests;
+                    jobs[i].outcome = result::skipped;
+                }
 
-        std::string rhs_value = line.substr(rhs_start, rhs_end - rhs_start);
+                continue;
+            }
 
-        // Remove quotes if present
-        if (!rhs_value.empty() && rhs_value.front() == '\'' && rhs_value.back() == '\'')
-        {
-            rhs_value = rhs_value.substr(1, rhs_value.length() - 2);
+            busy += evaluate_phase(jobs, phase, threads);
         }
 
-        // Select appropriate decimal type based on precision
-        try
+        const auto wall {std::chrono::steady_clock::now() - start};
+
+        // Report in file order from this thread, failed cases are evaluated again to print what went wrong
+        rounding current {rounding::unspecified};
+        bool first {true};
+        for (const auto& j : jobs)
         {
-            if (current_precision <= 9)
+            if (j.outcome == result::invalid)
             {
-                // Use decimal32_t
-                const boost::decimal::decimal32_t lhs1 {lhs1_value};
-                const boost::decimal::decimal32_t lhs2 {lhs2_value};
-                const boost::decimal::decimal32_t rhs {rhs_value};
-                const auto f_result {f(lhs1, lhs2)};  // Generic lambda works here
-
-                if ((isnan(lhs1) && isnan(lhs2)) || isnan(rhs))
-                {
-                    std::uint32_t result_bits;
-                    std::memcpy(&result_bits, &f_result, sizeof(std::uint32_t));
-
-                    std::uint32_t rhs_bits;
-                    std::memcpy(&rhs_bits, &rhs, sizeof(std::uint32_t));
+                ++j.handler->invalid_tests;
+            }
+            else if (j.outcome == result::failed)
+            {
+                ++j.handler->failed_tests;
 
-                    if (!BOOST_TEST_EQ(result_bits, rhs_bits))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (ulp_tol != 0)
+                if (first || j.round != current)
                 {
-                    const auto dist {ulp_distance(f_result, rhs)};
-                    if (!BOOST_TEST_LE(dist, ulp_tol))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << "\n"
-                                  << "Got: " << f_result << "\nExpected: " << rhs << std::endl;
-                    }
-                }
-                else if (!BOOST_TEST_EQ(f_result, rhs))  // Generic lambda works here
-                {
-                    std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
+                    apply_rounding(j.round, entry_round);
+                    current = j.round;
+                    first = false;
                 }
+
+                detail::current_outcome().repeated = true;
+                evaluate_case(*j.handler, j.tc);
+                detail::current_outcome().repeated = false;
             }
-            else if (current_precision <= 16)
-            {
-                // Use decimal64_t
-                const boost::decimal::decimal64_t lhs1 {lhs1_value};
-                const boost::decimal::decimal64_t lhs2 {lhs2_value};
-                const boost::decimal::decimal64_t rhs {rhs_value};
-                const auto f_result {f(lhs1, lhs2)};
+        }
 
-                if ((isnan(lhs1) && isnan(lhs2)) || isnan(rhs))
-                {
-                    std::uint64_t result_bits;
-                    std::memcpy(&result_bits, &f_result, sizeof(std::uint64_t));
+        boost::decimal::fesetround(entry_round);
 
-                    std::uint64_t rhs_bits;
-                    std::memcpy(&rhs_bits, &rhs, sizeof(std::uint64_t));
+        const auto wall_ms {std::chrono::duration<double, std::milli>(wall).count()};
+        const auto busy_ms {std::chrono::duration<double, std::milli>(busy).count()};
+        const auto speedup {wall_ms > 0.0 ? busy_ms / wall_ms : 0.0};
 
-                    if (!BOOST_TEST_EQ(result_bits, rhs_bits))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (ulp_tol != 0)
-                {
-                    const auto dist {ulp_distance(f_result, rhs)};
-                    if (!BOOST_TEST_LE(dist, ulp_tol))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << "\n"
-                                  << "Got: " << f_result << "\nExpected: " << rhs << std::endl;
-                    }
-                }
-                else if (!BOOST_TEST_EQ(f_result, rhs))
-                {
-                    std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                }
-            }
-            else
-            {
-                #if defined(__GNUC__) && !defined(__clang__)
-                #  pragma GCC diagnostic push
-                #  pragma GCC diagnostic ignored "-Wclass-memaccess"
-                #endif
-
-                // Use decimal128_t
-                const boost::decimal::decimal128_t lhs1 {lhs1_value};
-                const boost::decimal::decimal128_t lhs2 {lhs2_value};
-                const boost::decimal::decimal128_t rhs {rhs_value};
-                const auto f_result {f(lhs1, lhs2)};
-
-                if ((isnan(lhs1) && isnan(lhs2)) || isnan(rhs))
-                {
-                    boost::int128::uint128_t result_bits;
-                    std::memcpy(&result_bits, &f_result, sizeof(boost::int128::uint128_t));
+        // The busy time is what a single thread would have needed, so busy / wall is the speedup
+        std::ostringstream summary;
+        summary << std::fixed << std::setprecision(2)
+                << "\nEvaluated " << jobs.size() << " test cases from " << file_paths.size() << " files in "
+                << modes.size() << " rounding phases on " << threads << " threads\n"
+                << "Wall time: " << wall_ms << " ms, busy time: " << busy_ms << " ms\n"
+                << "Speedup: " << speedup << ", scaling efficiency: "
+                << 100.0 * speedup / static_cast<double>(threads) << "%\n";
+        std::cerr << summary.str() << std::endl;
 
-                    boost::int128::uint128_t rhs_bits;
-                    std::memcpy(&rhs_bits, &rhs, sizeof(boost::int128::uint128_t));
+        report(file_paths.size() == 1U ? file_paths.front() : std::string("all files"), true);
 
-                    if (!BOOST_TEST_EQ(result_bits, rhs_bits))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (ulp_tol != 0)
-                {
-                    const auto dist {ulp_distance(f_result, rhs)};
-                    if (!BOOST_TEST_LE(dist, ulp_tol))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << "\n"
-                                  << "Got: " << f_result << "\nExpected: " << rhs << std::endl;
-                    }
-                }
-                else if (!BOOST_TEST_EQ(f_result, rhs))
-                {
-                    std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                }
+        if (!results_path_.empty())
+        {
+            // The cases of all the files share the workers, so there is no time per file
+            write_results(file_paths, jobs, std::vector<std::chrono::steady_clock::duration>(handlers_.size()));
+        }
+    }
+
+private:
+    enum class result : std::uint8_t
+    {
+        passed,
+        failed,
+        invalid,
+        skipped
+    };
 
-                #ifdef __GNUC__
-                #  pragma GCC diagnostic pop
-                #endif
+    struct job
+    {
+        test_case tc;
+        op_handler* handler;
+        rounding round;
+        result outcome;
+        std::size_t file; // index into the files of the run
+    };
+
+    // The cases of one op that run() evaluates under the same rounding mode and precision, as indices into its jobs
+    struct batch
+    {
+        string_view op;
+        op_handler* handler;
+        rounding round;
+        int precision;
+        std::vector<std::size_t> cases;
+        std::chrono::steady_clock::duration elapsed;
+        bool skipped;
+        perf_sample counters;
+    };
+
+    static std::size_t default_thread_count()
+    {
+        const char* env {detail::environment("BOOST_DECIMAL_DECTEST_THREADS")};
+
+        if (env != nullptr)
+        {
+            int threads {};
+            if (detail::parse_int(string_view(env), threads) && threads > 0)
+            {
+                return static_cast<std::size_t>(threads);
             }
         }
-        catch (...)
+
+        const auto hardware {std::thread::hardware_concurrency()};
+        return hardware == 0U ? 1U : static_cast<std::size_t>(hardware);
+    }
+
+    // unspecified means whatever mode was set when the run started
+    static bool apply_rounding(const rounding mode, const rounding_mode entry_round)
+    {
+        if (mode == rounding::unspecified)
         {
-            // Invalid construction is supposed to throw
-            ++invalid_tests;
+            boost::decimal::fesetround(entry_round);
+            return true;
         }
+
+        return set_dectest_rounding(mode);
     }
 
-    if (skip_counter > 0U)
+    // Evaluates one case and returns what it found. Only the outcome of this thread is touched
+    static result evaluate_case(op_handler& handler, const test_case& tc)
     {
-        std::cerr << "Skipped: " << skip_counter << " due to invalid rounding mode.\n";
-        total_skipped_tests += skip_counter;
-    }
+        auto& outcome {detail::current_outcome()};
+        outcome.failed = false;
+        outcome.invalid = false;
 
-    std::cerr << "\nTotal number of tests: " << num_tests_found << "\n";
-    std::cerr << "Total number of skipped tests: " << total_skipped_tests << "\n" << std::endl;
+        handler.evaluate(tc);
 
-    BOOST_TEST_GT(num_tests_found, 0U);
-    BOOST_TEST_LT(invalid_tests, num_tests_found);
-}
+        if (outcome.invalid)
+        {
+            return result::invalid;
+        }
 
-inline void test_comparisons(const std::string& file_path, const std::string& function_name)
-{
-    const auto full_path {boost::decimal::dectest::where_file(file_path)};
-    if (full_path.empty())
-    {
-        std::cerr << "Failed to find file: " << file_path << std::endl;
-        BOOST_TEST(false);
-        return;
+        return outcome.failed ? result::failed : result::passed;
     }
 
-    std::ifstream in(full_path.c_str());
-    if (!in.is_open())
+    // Workers take chunks of the phase from a shared counter until it runs out, so a worker that
+    // draws cheap cases simply takes more chunks. Returns the time the workers spent evaluating
+    static std::chrono::steady_clock::duration evaluate_phase(std::vector<job>& jobs, const std::vector<std::size_t>& phase, const std::size_t threads)
     {
-        std::cerr << "Failed to open file: " << full_path << std::endl;
-        BOOST_TEST(false);
-        return;
-    }
-
-    std::size_t num_tests_found {};
-    std::size_t invalid_tests {};
-    std::string line;
-    int current_precision = 16;
+        constexpr std::size_t chunk_size {64U};
 
-    while (std::getline(in, line))
-    {
-        // Skip commented lines
-        if (line.find("#") != std::string::npos)
-        {
-            continue;
-        }
+        std::atomic<std::size_t> next {0U};
+        std::vector<std::chrono::steady_clock::duration> busy(threads);
 
-        // Check for precision specification
-        // When the precision is specified we ust that one until it is specified again
-        // Some of these test sets assume precisions we don't offer so this is the best effort
-        auto precision_pos = line.find("precision:");
-        if (precision_pos != std::string::npos)
+        const auto worker = [&](const std::size_t index)
         {
-            auto precision_start = precision_pos + 10; // Skip "precision:"
-
-            // Skip whitespace
-            while (precision_start < line.length() && std::isspace(line[precision_start]))
-            {
-                precision_start++;
-            }
+            const auto start {std::chrono::steady_clock::now()};
+            detail::current_outcome().quiet = true;
 
-            // Extract precision value
-            std::string precision_str;
-            while (precision_start < line.length() && std::isdigit(line[precision_start]))
+            for (;;)
             {
-                precision_str += line[precision_start++];
-            }
+                const auto first {next.fetch_add(chunk_size)};
+                if (first >= phase.size())
+                {
+                    break;
+                }
 
-            if (!precision_str.empty())
-            {
-                current_precision = std::stoi(precision_str);
+                const auto last {std::min(first + chunk_size, phase.size())};
+                for (auto i {first}; i < last; ++i)
+                {
+                    auto& j {jobs[phase[i]]};
+                    j.outcome = evaluate_case(*j.handler, j.tc);
+                }
             }
-            continue;
-        }
 
-        const auto first_space = line.find(" ");
-        const auto test_name = line.substr(0, first_space);
+            detail::current_outcome().quiet = false;
+            busy[index] = std::chrono::steady_clock::now() - start;
+        };
 
-        // Check if this line contains our function
-        const auto pos_test = line.find(function_name + " ");
-        if (pos_test == std::string::npos)
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1U);
+        for (std::size_t i {1U}; i < threads; ++i)
         {
-            continue;
+            pool.emplace_back(worker, i);
         }
 
-        ++num_tests_found;
+        // The calling thread is worker 0
+        worker(0U);
 
-        // Find the arrow separator
-        const auto arrow_pos = line.find("->");
-        if (arrow_pos == std::string::npos)
+        for (auto& thread : pool)
         {
-            std::cerr << "Invalid format: missing '->' in line: " << line << std::endl;
-            ++invalid_tests;
-            continue;
+            thread.join();
         }
 
-        // Extract the substring containing both LHS values
-        auto operands_start = pos_test + function_name.length() + 1;
-        auto operands_end = arrow_pos;
-
-        // Trim trailing whitespace
-        while (operands_end > operands_start && std::isspace(line[operands_end - 1]))
+        std::chrono::steady_clock::duration total {};
+        for (const auto b : busy)
         {
-            operands_end--;
+            total += b;
         }
 
-        std::string operands_str = line.substr(operands_start, operands_end - operands_start);
-
-        // Parse the two operands from the string
-        std::string lhs1_value, lhs2_value;
-        std::size_t i = 0;
+        return total;
+    }
 
-        // Skip leading whitespace
-        while (i < operands_str.length() && std::isspace(operands_str[i]))
+    void reset() noexcept
+    {
+        for (auto& entry : handlers_)
         {
-            i++;
+            entry.second->num_tests_found = 0U;
+            entry.second->invalid_tests = 0U;
+            entry.second->failed_tests = 0U;
+            entry.second->skipped_tests = 0U;
+            entry.second->ulp_errors.reset();
         }
+    }
 
-        // Parse first operand
-        if (i < operands_str.length() && operands_str[i] == '\'')
-        {
-            // Quoted value
-            i++; // Skip opening quote
-            std::size_t quote_end = operands_str.find('\'', i);
-            if (quote_end != std::string::npos)
-            {
-                lhs1_value = operands_str.substr(i, quote_end - i);
-                i = quote_end + 1;
-            }
-        }
-        else
+    // A selection or a shard may leave a file without any case to run
+    bool selective() const noexcept
+    {
+        return keep_ || shard_.active();
+    }
+
+    // Every op has to have cases, except that a file run by several ops needs cases for only one of them,
+    // and a selective run may leave anything empty. The handlers of one op (e.g. one per width) are counted
+    // together, so only a handler whose op has cases elsewhere is left out of the report when it found none.
+    // run_parallel covers the files of all its ops, so there every_op is true
+    void report(const std::string& file_path, const bool every_op = false) const
+    {
+        std::vector<std::pair<std::string, std::size_t>> op_found;
+        for (const auto& entry : handlers_)
         {
-            // Unquoted value
-            std::size_t start = i;
-            while (i < operands_str.length() && !std::isspace(operands_str[i]))
+            auto op {std::find_if(op_found.begin(), op_found.end(), [&](const std::pair<std::string, std::size_t>& o) { return o.first == entry.first; })};
+            if (op == op_found.end())
             {
-                i++;
+                op_found.emplace_back(entry.first, 0U);
+                op = op_found.end() - 1;
             }
-            lhs1_value = operands_str.substr(start, i - start);
-        }
 
-        // Skip whitespace between operands
-        while (i < operands_str.length() && std::isspace(operands_str[i]))
-        {
-            i++;
+            op->second += entry.second->num_tests_found;
         }
 
-        // Parse second operand
-        if (i < operands_str.length() && operands_str[i] == '\'')
+        std::size_t total_found {};
+        bool empty_op {};
+        for (const auto& op : op_found)
         {
-            // Quoted value
-            i++; // Skip opening quote
-            std::size_t quote_end = operands_str.find('\'', i);
-            if (quote_end != std::string::npos)
+            total_found += op.second;
+
+            if (op.second == 0U && !selective() && (every_op || op_found.size() == 1U))
             {
-                lhs2_value = operands_str.substr(i, quote_end - i);
-                i = quote_end + 1;
+                BOOST_TEST_GT(op.second, 0U);
+                std::cerr << "No test cases of " << op.first << " in " << file_path << std::endl;
+                empty_op = true;
             }
         }
-        else
+
+        for (const auto& entry : handlers_)
         {
-            // Unquoted value
-            std::size_t start = i;
-            while (i < operands_str.length() && !std::isspace(operands_str[i]))
+            const auto& handler {*entry.second};
+            if (handler.num_tests_found == 0U)
             {
-                i++;
+                continue;
             }
-            lhs2_value = operands_str.substr(start, i - start);
-        }
 
-        // Extract RHS value (after ->)
-        auto rhs_start = arrow_pos + 2; // Skip "->"
-        auto rhs_end = line.length();
+            std::cerr << "\nTotal number of tests: " << handler.num_tests_found << "\n";
+            std::cerr << "Total number of skipped tests: " << handler.skipped_tests << "\n" << std::endl;
 
-        // Trim whitespace
-        while (rhs_start < rhs_end && std::isspace(line[rhs_start]))
-        {
-            rhs_start++;
+            handler.ulp_errors.print(entry.first, file_path);
+
+            if (!BOOST_TEST_LT(handler.invalid_tests, handler.num_tests_found))
+            {
+                std::cerr << "Failed op: " << entry.first << " in " << file_path << std::endl;
+            }
         }
-        while (rhs_end > rhs_start && std::isspace(line[rhs_end - 1]))
+
+        if (!selective() && !empty_op && !BOOST_TEST_GT(total_found, 0U))
         {
-            rhs_end--;
+            std::cerr << "No test cases in " << file_path << std::endl;
         }
+    }
 
-        std::string rhs_value = line.substr(rhs_start, rhs_end - rhs_start);
-
-        // Remove quotes if present
-        if (!rhs_value.empty() && rhs_value.front() == '\'' && rhs_value.back() == '\'')
+    std::size_t handler_index(const op_handler* handler) const noexcept
+    {
+        std::size_t i {};
+        while (handlers_[i].second.get() != handler)
         {
-            rhs_value = rhs_value.substr(1, rhs_value.length() - 2);
+            ++i;
         }
 
-        // Select appropriate decimal type based on precision
-        try
-        {
-            const std::string eq = "0";
-            const std::string gt = "1";
-            const std::string lt = "-1";
+        return i;
+    }
 
-            if (current_precision <= 9)
+    // Appends the shard and a line per file and op with cases to the results file, elapsed is the time of each handler
+    void write_results(const std::vector<std::string>& file_paths, const std::vector<job>& jobs,
+                       const std::vector<std::chrono::steady_clock::duration>& elapsed) const
+    {
+        std::vector<shard_result> results;
+        for (std::size_t file {}; file < file_paths.size(); ++file)
+        {
+            for (std::size_t h {}; h < handlers_.size(); ++h)
             {
-                // Use decimal32_t
-                const boost::decimal::decimal32_t lhs1 {lhs1_value};
-                const boost::decimal::decimal32_t lhs2 {lhs2_value};
+                shard_result r;
+                r.shard = shard_name(shard_);
+                r.file = file_paths[file];
+                r.op = handlers_[h].first;
 
-                if (rhs_value == eq)
-                {
-                    if (!BOOST_TEST_EQ(lhs1, lhs2))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (rhs_value == gt)
-                {
-                    if (!BOOST_TEST_GT(lhs1, lhs2))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (rhs_value == lt)
+                for (const auto& j : jobs)
                 {
-                    if (!BOOST_TEST_LT(lhs1, lhs2))
+                    if (j.file != file || j.handler != handlers_[h].second.get())
                     {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
+                        continue;
                     }
-                }
-                else
-                {
-                    throw std::logic_error("Invalid comparison");
-                }
-            }
-            else if (current_precision <= 16)
-            {
-                // Use decimal64_t
-                const boost::decimal::decimal64_t lhs1 {lhs1_value};
-                const boost::decimal::decimal64_t lhs2 {lhs2_value};
 
-                if (rhs_value == eq)
-                {
-                    if (!BOOST_TEST_EQ(lhs1, lhs2))
+                    ++r.found;
+                    if (j.outcome == result::failed)
                     {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
+                        ++r.failed;
+                        r.failed_ids.emplace_back(j.tc.id.data(), j.tc.id.size());
                     }
-                }
-                else if (rhs_value == gt)
-                {
-                    if (!BOOST_TEST_GT(lhs1, lhs2))
+                    else if (j.outcome == result::invalid)
                     {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
+                        ++r.invalid;
                     }
-                }
-                else if (rhs_value == lt)
-                {
-                    if (!BOOST_TEST_LT(lhs1, lhs2))
+                    else if (j.outcome == result::skipped)
                     {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
+                        ++r.skipped;
                     }
                 }
-                else
-                {
-                    throw std::logic_error("Invalid comparison");
-                }
-            }
-            else
-            {
-                // Use decimal128_t
-                const boost::decimal::decimal128_t lhs1 {lhs1_value};
-                const boost::decimal::decimal128_t lhs2 {lhs2_value};
 
-                if (rhs_value == eq)
-                {
-                    if (!BOOST_TEST_EQ(lhs1, lhs2))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (rhs_value == gt)
-                {
-                    if (!BOOST_TEST_GT(lhs1, lhs2))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (rhs_value == lt)
+                if (r.found > 0U)
                 {
-                    if (!BOOST_TEST_LT(lhs1, lhs2))
+                    if (file_paths.size() == 1U)
                     {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
+                        r.microseconds = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed[h]).count());
                     }
-                }
-                else
-                {
-                    throw std::logic_error("Invalid comparison");
+
+                    results.push_back(std::move(r));
                 }
             }
         }
-        catch (...)
+
+        if (!append_results(results_path_, shard_name(shard_), results))
         {
-            // Invalid construction is supposed to throw
-            ++invalid_tests;
+            std::cerr << "Failed to write results to: " << results_path_ << std::endl;
+            BOOST_TEST(false);
         }
     }
 
-    BOOST_TEST_GT(num_tests_found, 0U);
-    BOOST_TEST_LT(invalid_tests, num_tests_found);
-}
-
-inline void test_comparetotal(const std::string& file_path, const std::string& function_name)
-{
-    const auto full_path {boost::decimal::dectest::where_file(file_path)};
-    if (full_path.empty())
-    {
-        std::cerr << "Failed to find file: " << file_path << std::endl;
-        BOOST_TEST(false);
-        return;
-    }
-
-    std::ifstream in(full_path.c_str());
-    if (!in.is_open())
-    {
-        std::cerr << "Failed to open file: " << full_path << std::endl;
-        BOOST_TEST(false);
-        return;
-    }
-
-    std::size_t num_tests_found {};
-    std::size_t invalid_tests {};
-    std::string line;
-    int current_precision = 16;
-
-    while (std::getline(in, line))
+    // The op of all the handlers when they share one, which lets the corpus hand us just its range, otherwise empty
+    string_view single_op() const noexcept
     {
-        // Skip commented lines
-        if (line.find("#") != std::string::npos)
+        for (const auto& entry : handlers_)
         {
-            continue;
-        }
-
-        // Check for precision specification
-        // When the precision is specified we ust that one until it is specified again
-        // Some of these test sets assume precisions we don't offer so this is the best effort
-        auto precision_pos = line.find("precision:");
-        if (precision_pos != std::string::npos)
-        {
-            auto precision_start = precision_pos + 10; // Skip "precision:"
-
-            // Skip whitespace
-            while (precision_start < line.length() && std::isspace(line[precision_start]))
+            if (entry.first != handlers_.front().first)
             {
-                precision_start++;
+                return string_view();
             }
+        }
 
-            // Extract precision value
-            std::string precision_str;
-            while (precision_start < line.length() && std::isdigit(line[precision_start]))
-            {
-                precision_str += line[precision_start++];
-            }
+        return handlers_.empty() ? string_view() : string_view(handlers_.front().first);
+    }
 
-            if (!precision_str.empty())
+    // The first handler of the op of tc that accepts it
+    op_handler* find_handler(const test_case& tc) const noexcept
+    {
+        for (const auto& entry : handlers_)
+        {
+            if (tc.op == entry.first && entry.second->accepts(tc))
             {
-                current_precision = std::stoi(precision_str);
+                return entry.second.get();
             }
-            continue;
         }
 
-        const auto first_space = line.find(" ");
-        const auto test_name = line.substr(0, first_space);
+        return nullptr;
+    }
 
-        // Check if this line contains our function
-        const auto pos_test = line.find(function_name + " ");
-        if (pos_test == std::string::npos)
+    // Counts tc for its handler and returns the handler if it should evaluate the case,
+    // nullptr for comments, ops without a handler and malformed cases
+    op_handler* accept(const test_case& tc) const
+    {
+        if ((tc.flags & case_flags::hash_marker) != 0U)
         {
-            continue;
+            // Skip commented lines
+            return nullptr;
         }
 
-        ++num_tests_found;
-
-        // Find the arrow separator
-        const auto arrow_pos = line.find("->");
-        if (arrow_pos == std::string::npos)
+        const auto handler {find_handler(tc)};
+        if (handler == nullptr || (reference_ && !reference_(tc)) ||
+            (shard_.active() && !shard_.contains(tc)) || (keep_ && !keep_(tc)))
         {
-            std::cerr << "Invalid format: missing '->' in line: " << line << std::endl;
-            ++invalid_tests;
-            continue;
+            return nullptr;
         }
 
-        // Extract the substring containing both LHS values
-        auto operands_start = pos_test + function_name.length() + 1;
-        auto operands_end = arrow_pos;
+        ++handler->num_tests_found;
 
-        // Trim trailing whitespace
-        while (operands_end > operands_start && std::isspace(line[operands_end - 1]))
+        if ((tc.flags & case_flags::malformed) != 0U || tc.operand_count != handler->arity())
         {
-            operands_end--;
+            std::cerr << "Invalid format in test: " << tc.id << std::endl;
+            ++handler->invalid_tests;
+            return nullptr;
         }
 
-        std::string operands_str = line.substr(operands_start, operands_end - operands_start);
-
-        // Parse the two operands from the string
-        std::string lhs1_value, lhs2_value;
-        std::size_t i = 0;
+        return handler;
+    }
 
-        // Skip leading whitespace
-        while (i < operands_str.length() && std::isspace(operands_str[i]))
+    // The time of each batch of run(). It includes constructing the operands and checking the results,
+    // so it compares rounding modes and precisions with each other rather than measuring the op alone
+    static void print_batches(const std::string& file_path, const std::vector<batch>& batches)
+    {
+        std::ostringstream table;
+        table << "\nBatches of " << file_path << ":\n"
+              << std::left << std::setw(14) << "op" << std::setw(14) << "rounding"
+              << std::right << std::setw(10) << "precision" << std::setw(8) << "width" << std::setw(10) << "cases"
+              << std::setw(12) << "ns/case" << std::setw(12) << "total ms";
+
+        // Only the counters some batch has, per case
+        perf_sample counted;
+        for (const auto& b : batches)
         {
-            i++;
+            counted += b.counters;
         }
 
-        // Parse first operand
-        if (i < operands_str.length() && operands_str[i] == '\'')
-        {
-            // Quoted value
-            i++; // Skip opening quote
-            std::size_t quote_end = operands_str.find('\'', i);
-            if (quote_end != std::string::npos)
-            {
-                lhs1_value = operands_str.substr(i, quote_end - i);
-                i = quote_end + 1;
-            }
-        }
-        else
+        for (std::size_t c {}; c < perf_counter_count; ++c)
         {
-            // Unquoted value
-            std::size_t start = i;
-            while (i < operands_str.length() && !std::isspace(operands_str[i]))
+            if (counted.valid[c])
             {
-                i++;
+                table << std::setw(12) << perf_counter_names[c];
             }
-            lhs1_value = operands_str.substr(start, i - start);
-        }
-
-        // Skip whitespace between operands
-        while (i < operands_str.length() && std::isspace(operands_str[i]))
-        {
-            i++;
         }
 
-        // Parse second operand
-        if (i < operands_str.length() && operands_str[i] == '\'')
-        {
-            // Quoted value
-            i++; // Skip opening quote
-            std::size_t quote_end = operands_str.find('\'', i);
-            if (quote_end != std::string::npos)
-            {
-                lhs2_value = operands_str.substr(i, quote_end - i);
-                i = quote_end + 1;
-            }
-        }
-        else
+        const auto ipc {counted.valid[perf_instructions] && counted.valid[perf_cycles]};
+        if (ipc)
         {
-            // Unquoted value
-            std::size_t start = i;
-            while (i < operands_str.length() && !std::isspace(operands_str[i]))
-            {
-                i++;
-            }
-            lhs2_value = operands_str.substr(start, i - start);
+            table << std::setw(8) << "IPC";
         }
 
-        // Extract RHS value (after ->)
-        auto rhs_start = arrow_pos + 2; // Skip "->"
-        auto rhs_end = line.length();
+        table << '\n';
 
-        // Trim whitespace
-        while (rhs_start < rhs_end && std::isspace(line[rhs_start]))
-        {
-            rhs_start++;
-        }
-        while (rhs_end > rhs_start && std::isspace(line[rhs_end - 1]))
+        for (const auto& b : batches)
         {
-            rhs_end--;
-        }
+            const auto width {detail::width_of(b.precision)};
+            const auto ns {std::chrono::duration<double, std::nano>(b.elapsed).count()};
 
-        std::string rhs_value = line.substr(rhs_start, rhs_end - rhs_start);
+            table << std::left << std::setw(14) << std::string(b.op.data(), b.op.size())
+                  << std::setw(14) << (b.round == rounding::unspecified ? "default" : rounding_name(b.round))
+                  << std::right << std::setw(10) << b.precision << std::setw(8) << width << std::setw(10) << b.cases.size();
 
-        // Remove quotes if present
-        if (!rhs_value.empty() && rhs_value.front() == '\'' && rhs_value.back() == '\'')
-        {
-            rhs_value = rhs_value.substr(1, rhs_value.length() - 2);
-        }
+            if (b.skipped)
+            {
+                table << std::setw(24) << "skipped" << '\n';
+                continue;
+            }
 
-        // Select appropriate decimal type based on precision
-        try
-        {
-            const std::string eq = "0";
-            const std::string gt = "1";
-            const std::string lt = "-1";
+            table << std::fixed << std::setprecision(1)
+                  << std::setw(12) << ns / static_cast<double>(b.cases.size())
+                  << std::setprecision(3) << std::setw(12) << ns / 1e6;
 
-            if (current_precision <= 9)
+            const auto cases {static_cast<double>(b.cases.size())};
+            table << std::setprecision(1);
+            for (std::size_t c {}; c < perf_counter_count; ++c)
             {
-                // Use decimal32_t
-                const boost::decimal::decimal32_t lhs1 {lhs1_value};
-                const boost::decimal::decimal32_t lhs2 {lhs2_value};
-
-                if (rhs_value == eq)
-                {
-                    if ((isinf(lhs1) && isinf(lhs2) && (signbit(lhs1) == signbit(lhs2))) || (isnan(lhs1) && isnan(lhs2)))
-                    {
-                        if (!BOOST_TEST(boost::decimal::comparetotal(lhs1, lhs2) == boost::decimal::comparetotal(lhs2, lhs1)))
-                        {
-                            std::cerr << "Failed test: " << test_name << " (" << test_name << ")" << std::endl;
-                        }
-                    }
-                    else if (!(BOOST_TEST(boost::decimal::comparetotal(lhs1, lhs2)) && BOOST_TEST(boost::decimal::comparetotal(lhs2, lhs1))))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (rhs_value == gt)
-                {
-                    if (!BOOST_TEST(boost::decimal::comparetotal(lhs2, lhs1)))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (rhs_value == lt)
-                {
-                    if (!BOOST_TEST(boost::decimal::comparetotal(lhs1, lhs2)))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else
+                if (counted.valid[c])
                 {
-                    throw std::logic_error("Invalid comparison");
+                    table << std::setw(12) << static_cast<double>(b.counters.counts[c]) / cases;
                 }
             }
-            else if (current_precision <= 16)
-            {
-                // Use decimal64_t
-                const boost::decimal::decimal64_t lhs1 {lhs1_value};
-                const boost::decimal::decimal64_t lhs2 {lhs2_value};
 
-                if (rhs_value == eq)
-                {
-                    if ((isinf(lhs1) && isinf(lhs2) && (signbit(lhs1) == signbit(lhs2))) || (isnan(lhs1) && isnan(lhs2)))
-                    {
-                        if (!BOOST_TEST(boost::decimal::comparetotal(lhs1, lhs2) == boost::decimal::comparetotal(lhs2, lhs1)))
-                        {
-                            std::cerr << "Failed test: " << test_name << " (" << test_name << ")" << std::endl;
-                        }
-                    }
-                    else if (!(BOOST_TEST(boost::decimal::comparetotal(lhs1, lhs2)) && BOOST_TEST(boost::decimal::comparetotal(lhs2, lhs1))))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (rhs_value == gt)
-                {
-                    if (!BOOST_TEST(boost::decimal::comparetotal(lhs2, lhs1)))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (rhs_value == lt)
-                {
-                    if (!BOOST_TEST(boost::decimal::comparetotal(lhs1, lhs2)))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else
-                {
-                    throw std::logic_error("Invalid comparison");
-                }
-            }
-            else
+            if (ipc && b.counters.counts[perf_cycles] != 0U)
             {
-                // Use decimal128_t
-                const boost::decimal::decimal128_t lhs1 {lhs1_value};
-                const boost::decimal::decimal128_t lhs2 {lhs2_value};
-
-                if (rhs_value == eq)
-                {
-                    if ((isinf(lhs1) && isinf(lhs2) && (signbit(lhs1) == signbit(lhs2))) || (isnan(lhs1) && isnan(lhs2)))
-                    {
-                        if (!BOOST_TEST(boost::decimal::comparetotal(lhs1, lhs2) == boost::decimal::comparetotal(lhs2, lhs1)))
-                        {
-                            std::cerr << "Failed test: " << test_name << " (" << test_name << ")" << std::endl;
-                        }
-                    }
-                    else if (!(BOOST_TEST(boost::decimal::comparetotal(lhs1, lhs2)) && BOOST_TEST(boost::decimal::comparetotal(lhs2, lhs1))))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (rhs_value == gt)
-                {
-                    if (!BOOST_TEST(boost::decimal::comparetotal(lhs2, lhs1)))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else if (rhs_value == lt)
-                {
-                    if (!BOOST_TEST(boost::decimal::comparetotal(lhs1, lhs2)))
-                    {
-                        std::cerr << "Failed test: " << test_name << " (precision: " << current_precision << ")" << std::endl;
-                    }
-                }
-                else
-                {
-                    throw std::logic_error("Invalid comparison");
-                }
+                table << std::setprecision(2) << std::setw(8)
+                      << static_cast<double>(b.counters.counts[perf_instructions]) / static_cast<double>(b.counters.counts[perf_cycles]);
             }
+
+            table << std::defaultfloat << '\n';
         }
-        catch (...)
-        {
-            // Invalid construction is supposed to throw
-            ++invalid_tests;
-        }
+
+        std::cerr << table.str() << std::endl;
     }
 
-    BOOST_TEST_GT(num_tests_found, 0U);
-    BOOST_TEST_LT(invalid_tests, num_tests_found);
+    std::vector<std::pair<std::string, std::unique_ptr<op_handler>>> handlers_;
+    std::function<bool(const test_case&)> reference_;
+    std::function<bool(const test_case&)> keep_;
+    shard_spec shard_ {detail::shard_from_environment()};
+    std::string results_path_ {detail::results_from_environment()};
+    bool allow_rounding_changes_;
+    std::size_t latency_top_ {detail::latency_from_environment()};
+    latency_report* latency_ {nullptr};
+    bool perf_ {detail::perf_from_environment()};
+};
+
+} // namespace dectest
+} // namespace decimal
+} // namespace boost
+
+template <typename Function>
+void test_one_arg_harness(const std::string& file_path, const std::string& function_name, Function f, const std::size_t ulp_tol = 0U)
+{
+    boost::decimal::dectest::dectest_runner runner;
+    runner.add_one_arg(function_name, f, ulp_tol);
+    runner.run(file_path);
+}
+
+template <bool allow_rounding_changes = false, typename Function = std::minus<>()>
+void test_two_arg_harness(const std::string& file_path, const std::string& function_name, Function f, const std::size_t ulp_tol = 0)
+{
+    boost::decimal::dectest::dectest_runner runner {allow_rounding_changes};
+    runner.add_two_arg(function_name, f, ulp_tol);
+    runner.run(file_path);
+}
+
+inline void test_comparisons(const std::string& file_path, const std::string& function_name)
+{
+    boost::decimal::dectest::dectest_runner runner;
+    runner.add_comparisons(function_name);
+    runner.run(file_path);
+}
+
+inline void test_comparetotal(const std::string& file_path, const std::string& function_name)
+{
+    boost::decimal::dectest::dectest_runner runner;
+    runner.add_comparetotal(function_name);
+    runner.run(file_path);
 }
 
 #endif // BOOST_DECIMAL_DECTEST_TEST_HARNESS_HPP
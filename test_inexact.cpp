@@ -0,0 +1,45 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_registry.hpp"
+
+// inexact0.decTest mixes add, divide, multiply, plus, power and rescale
+void test_single_pass()
+{
+    using boost::decimal::dectest::test_case;
+    using boost::decimal::dectest::for_each_case;
+
+    std::size_t all_cases {};
+    BOOST_TEST(for_each_case("dectest0/inexact0.decTest", [&](const test_case&) { ++all_cases; }));
+
+    std::size_t op_cases {};
+    for (const auto op : {"add", "divide", "multiply", "plus", "power", "rescale"})
+    {
+        BOOST_TEST(for_each_case("dectest0/inexact0.decTest", op, [&](const test_case&) { ++op_cases; }));
+    }
+
+    BOOST_TEST_GT(all_cases, 0U);
+    BOOST_TEST_EQ(all_cases, op_cases);
+}
+
+int main()
+{
+    test_single_pass();
+
+    std::cerr << std::setprecision(17);
+
+    // All the registered ops of the file on one runner, which reads it once
+    boost::decimal::dectest::dectest_runner runner;
+    boost::decimal::dectest::register_add(runner);
+    boost::decimal::dectest::register_divide(runner);
+    boost::decimal::dectest::register_multiply(runner);
+    boost::decimal::dectest::register_plus(runner);
+
+    runner.run("dectest0/inexact0.decTest");
+
+    return boost::report_errors();
+}
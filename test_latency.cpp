@@ -0,0 +1,135 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include <sstream>
+
+using namespace boost::decimal::dectest;
+
+test_case make_case(const char* id, const char* lhs, const char* rhs)
+{
+    test_case tc;
+    tc.id = id;
+    tc.op = "add";
+    tc.operands[0] = lhs;
+    tc.operands[1] = rhs;
+    tc.operand_count = 2U;
+    return tc;
+}
+
+void test_report()
+{
+    latency_report report {2U};
+    report.record(make_case("add001", "1", "1"), 1U);
+    report.record(make_case("add002", "1E+384", "-1E-398"), 300U);
+    report.record(make_case("add003", "2", "3"), 3U);
+    report.record(make_case("add004", "9.999", "1E-5"), 300U);
+    report.record(make_case("add005", "7", "8"), 40U);
+
+    BOOST_TEST_EQ(report.size(), 5U);
+
+    const auto& histogram {report.histogram()};
+    BOOST_TEST_EQ(histogram[0], 1U);
+    BOOST_TEST_EQ(histogram[1], 1U);
+    BOOST_TEST_EQ(histogram[5], 1U);
+    BOOST_TEST_EQ(histogram[8], 2U);
+
+    // Slowest first, ties stay in file order
+    const auto slowest {report.slowest()};
+    BOOST_TEST_EQ(slowest.size(), 2U);
+    BOOST_TEST_EQ(slowest[0].id, "add002");
+    BOOST_TEST_EQ(slowest[0].operation, "add 1E+384 -1E-398");
+    BOOST_TEST_EQ(slowest[1].id, "add004");
+
+    std::ostringstream os;
+    report.print("mem/add.decTest", os);
+    BOOST_TEST(os.str().find("Slowest 2:") != std::string::npos);
+    BOOST_TEST(os.str().find("add002") != std::string::npos);
+    BOOST_TEST(os.str().find("add005") == std::string::npos);
+}
+
+void test_classes()
+{
+    context ctx;
+    ctx.precision = 16;
+    ctx.max_exponent = 384;
+    ctx.min_exponent = -383;
+
+    BOOST_TEST(classify_operand("0", ctx).cls == operand_class::zero);
+    BOOST_TEST(classify_operand("-0.000E+7", ctx).cls == operand_class::zero);
+    BOOST_TEST(classify_operand("-Inf", ctx).cls == operand_class::infinite);
+    BOOST_TEST(classify_operand("Infinity", ctx).cls == operand_class::infinite);
+    BOOST_TEST(classify_operand("NaN123", ctx).cls == operand_class::qnan);
+    BOOST_TEST(classify_operand("-sNaN", ctx).cls == operand_class::snan);
+    BOOST_TEST(classify_operand("#2238000000000000", ctx).cls == operand_class::encoded);
+    BOOST_TEST(classify_operand("1..2", ctx).cls == operand_class::invalid);
+    BOOST_TEST(classify_operand("1E", ctx).cls == operand_class::invalid);
+
+    BOOST_TEST(classify_operand("1E-383", ctx).cls == operand_class::normal);
+    BOOST_TEST(classify_operand("0.1E-383", ctx).cls == operand_class::subnormal);
+    BOOST_TEST(classify_operand("1000E-386", ctx).cls == operand_class::normal);
+    BOOST_TEST_EQ(classify_operand("0.00123", ctx).adjusted_exponent, -3);
+    BOOST_TEST_EQ(classify_operand("123", ctx).adjusted_exponent, 2);
+
+    auto tc {make_case("add001", "1", "1")};
+    tc.ctx = ctx;
+    BOOST_TEST_EQ(case_class(tc), "normal x normal, gap 0");
+
+    tc.operands[1] = "1E-10";
+    BOOST_TEST_EQ(case_class(tc), "normal x normal, gap <= p");
+
+    tc.operands[1] = "1E-390";
+    BOOST_TEST_EQ(case_class(tc), "normal x subnormal, gap > p");
+
+    tc.operands[1] = "-Inf";
+    BOOST_TEST_EQ(case_class(tc), "normal x inf");
+
+    // The groups of the report, slowest median first
+    latency_report report {1U};
+    report.record(make_case("add001", "1", "1"), 10U);
+    report.record(make_case("add002", "2", "3"), 30U);
+    report.record(make_case("add003", "4", "5"), 20U);
+    report.record(make_case("add004", "NaN", "1"), 100U);
+
+    const auto groups {report.by_class()};
+    BOOST_TEST_EQ(groups.size(), 2U);
+    BOOST_TEST_EQ(groups[0].label, "qNaN x normal");
+    BOOST_TEST_EQ(groups[1].count, 3U);
+    BOOST_TEST_EQ(groups[1].median, 20U);
+    BOOST_TEST_EQ(groups[1].max, 30U);
+}
+
+void test_timed_call()
+{
+    const auto add = [](const int x, const int y) { return x + y; };
+
+    detail::last_latency() = 0U;
+    BOOST_TEST_EQ(detail::timed_call(add, 1, 2), 3);
+    BOOST_TEST_EQ(detail::last_latency(), 0U);
+
+    detail::latency_enabled() = true;
+    BOOST_TEST_EQ(detail::timed_call(add, 1, 2), 3);
+    BOOST_TEST_GT(detail::last_latency(), 0U);
+    detail::latency_enabled() = false;
+}
+
+int main()
+{
+    test_report();
+    test_classes();
+    test_timed_call();
+
+    // Prints the histogram and the slowest ids, the checks themselves are unchanged
+    dectest_runner runner;
+    runner.record_latency(10U)
+          .add_two_arg("add", [](const auto x, const auto y) { return x + y; })
+          .add_two_arg("divide", [](const auto x, const auto y) { return x / y; });
+
+    runner.run("dectest0/add0.decTest");
+    runner.run("dectest0/divide0.decTest");
+
+    return boost::report_errors();
+}
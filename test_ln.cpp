@@ -0,0 +1,17 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_registry.hpp"
+
+int main()
+{
+    std::cerr << std::setprecision(std::numeric_limits<boost::decimal::decimal128_t>::max_digits10);
+
+    boost::decimal::dectest::run_registered("ln", boost::decimal::dectest::register_ln<>);
+
+    return boost::report_errors();
+}
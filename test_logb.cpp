@@ -0,0 +1,42 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_registry.hpp"
+
+// ilogb returns FP_ILOGB0 and FP_ILOGBNAN where logb returns an infinity or a NaN,
+// so it only has the result of the file for finite non-zero operands
+bool finite_non_zero(const boost::decimal::dectest::test_case& tc)
+{
+    using boost::decimal::dectest::operand_class;
+
+    const auto cls {boost::decimal::dectest::classify_operand(tc.operands[0], tc.ctx).cls};
+    return cls == operand_class::normal || cls == operand_class::subnormal;
+}
+
+template <typename T>
+void test_ilogb(const std::string& file)
+{
+    std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10);
+
+    boost::decimal::dectest::dectest_runner integer;
+    integer.restrict_to(finite_non_zero)
+           .add_typed<T, 1U>("logb", [](const T x) { return T {ilogb(x)}; });
+    integer.run(file);
+}
+
+int main()
+{
+    using namespace boost::decimal;
+
+    std::cerr << std::setprecision(std::numeric_limits<decimal128_t>::max_digits10);
+    dectest::run_registered("logb", dectest::register_logb<>);
+
+    test_ilogb<decimal64_t>("archive/dectest/ddLogB.decTest");
+    test_ilogb<decimal128_t>("archive/dectest/dqLogB.decTest");
+
+    return boost::report_errors();
+}
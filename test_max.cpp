@@ -5,16 +5,13 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    std::cerr << std::setprecision(17);
-    test_two_arg_harness("dectest0/max0.decTest", "max", [](const auto x, const auto y) { return boost::decimal::fmax(x, y); });
-    test_two_arg_harness("dectest/max.decTest", "max", [](const auto x, const auto y) { return boost::decimal::fmax(x, y); });
-    test_two_arg_harness("dectest/ddMax.decTest", "max", [](const auto x, const auto y) { return boost::decimal::fmax(x, y); });
+    std::cerr << std::setprecision(std::numeric_limits<boost::decimal::decimal128_t>::max_digits10);
 
-    std::cerr << std::setprecision(34);
-    test_two_arg_harness("dectest/dqMax.decTest", "max", [](const auto x, const auto y) { return boost::decimal::fmax(x, y); });
+    boost::decimal::dectest::run_registered("max", boost::decimal::dectest::register_max<>);
 
     return boost::report_errors();
 }
@@ -5,16 +5,13 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    std::cerr << std::setprecision(17);
-    test_two_arg_harness("dectest0/min0.decTest", "min", [](const auto x, const auto y) { return boost::decimal::fmin(x, y); });
-    test_two_arg_harness("dectest/min.decTest", "min", [](const auto x, const auto y) { return boost::decimal::fmin(x, y); });
-    test_two_arg_harness("dectest/ddMin.decTest", "min", [](const auto x, const auto y) { return boost::decimal::fmin(x, y); });
+    std::cerr << std::setprecision(std::numeric_limits<boost::decimal::decimal128_t>::max_digits10);
 
-    std::cerr << std::setprecision(34);
-    test_two_arg_harness("dectest/dqMin.decTest", "min", [](const auto x, const auto y) { return boost::decimal::fmin(x, y); });
+    boost::decimal::dectest::run_registered("min", boost::decimal::dectest::register_min<>);
 
     return boost::report_errors();
 }
@@ -5,11 +5,11 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    test_one_arg_harness("dectest0/minus0.decTest", "minus", [](const auto x) { return -x; });
-    test_one_arg_harness("dectest/minus.decTest", "minus", [](const auto x) { return -x; });
+    boost::decimal::dectest::run_registered("minus", boost::decimal::dectest::register_minus<>);
 
     return boost::report_errors();
 }
@@ -5,22 +5,12 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    std::cerr << std::setprecision(17);
-    test_two_arg_harness("dectest0/multiply0.decTest", "multiply", [](const auto x, const auto y) { return x * y; });
-    test_two_arg_harness("dectest0/inexact0.decTest", "multiply", [](const auto x, const auto y) { return x * y; });
-
-    std::cerr << std::setprecision(34);
-    test_two_arg_harness("dectest/multiply.decTest", "multiply", [](const auto x, const auto y) { return x * y; });
-
-    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
-
-    test_two_arg_harness<true>("dectest/ddMultiply.decTest", "multiply", [](const auto x, const auto y) { return x * y; });
-    test_two_arg_harness<true>("dectest/dqMultiply.decTest", "multiply", [](const auto x, const auto y) { return x * y; });
-
-    #endif
+    std::cerr << std::setprecision(std::numeric_limits<boost::decimal::decimal128_t>::max_digits10);
+    boost::decimal::dectest::run_registered("multiply", boost::decimal::dectest::register_multiply<>);
 
     return boost::report_errors();
 }
@@ -0,0 +1,65 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_registry.hpp"
+#include <cstdio>
+#include <fstream>
+
+// The registry checks nexttoward through nextafter, this is nexttoward with the direction as a long double
+template <typename T>
+void test_nexttoward(const std::string& file)
+{
+    std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10);
+
+    boost::decimal::dectest::dectest_runner toward;
+    toward.restrict_to(boost::decimal::dectest::long_double_direction<T>)
+          .template add_typed<T, 2U>("nexttoward", [](const T x, const T y) { return nexttoward(x, static_cast<long double>(y)); });
+    toward.run(file);
+}
+
+// The NaN operands of nexttoward, with or without a payload, are not parsed by the selection
+void test_nan_direction()
+{
+    using T = boost::decimal::decimal64_t;
+
+    const std::string path {"test_next_nan.decTest"};
+    {
+        std::ofstream out(path.c_str());
+        out << "precision: 16\n"
+            << "nant001 nexttoward NaN77 Infinity -> NaN77\n"
+            << "nant002 nexttoward -sNaN88 1 -> -NaN88 Invalid_operation\n"
+            << "nant003 nexttoward 1 NaN -> NaN\n"
+            << "nant004 nexttoward 1 Infinity -> 1.000000000000001\n";
+    }
+
+    std::size_t selected {};
+    BOOST_TEST(boost::decimal::dectest::for_each_case(path, [&](const boost::decimal::dectest::test_case& tc)
+    {
+        selected += boost::decimal::dectest::long_double_direction<T>(tc) ? 1U : 0U;
+    }));
+    BOOST_TEST_EQ(selected, 1U);
+
+    test_nexttoward<T>(path);
+
+    std::remove(path.c_str());
+}
+
+int main()
+{
+    using namespace boost::decimal;
+
+    std::cerr << std::setprecision(std::numeric_limits<decimal128_t>::max_digits10);
+    dectest::run_registered("nextplus", dectest::register_nextplus<>);
+    dectest::run_registered("nextminus", dectest::register_nextminus<>);
+    dectest::run_registered("nexttoward", dectest::register_nexttoward<>);
+
+    test_nan_direction();
+    test_nexttoward<decimal64_t>("archive/dectest/ddNextToward.decTest");
+    test_nexttoward<decimal128_t>("archive/dectest/dqNextToward.decTest");
+
+    return boost::report_errors();
+}
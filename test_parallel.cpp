@@ -0,0 +1,80 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+
+// Runs files on one runner with run_parallel and file by file on another with run,
+// a case lost or evaluated twice by the workers shows up as a difference in the totals
+template <typename AddOps>
+void test_against_serial(const std::vector<std::string>& files, const bool allow_rounding_changes, AddOps add_ops)
+{
+    boost::decimal::dectest::dectest_runner parallel {allow_rounding_changes};
+    add_ops(parallel);
+    parallel.run_parallel(files);
+    const auto parallel_totals {parallel.totals()};
+
+    boost::decimal::dectest::dectest_runner serial {allow_rounding_changes};
+    add_ops(serial);
+    boost::decimal::dectest::run_totals serial_totals;
+    for (const auto& file : files)
+    {
+        serial.run(file);
+        serial_totals += serial.totals();
+    }
+
+    BOOST_TEST_GT(parallel_totals.found, 0U);
+    BOOST_TEST_EQ(parallel_totals.found, serial_totals.found);
+    BOOST_TEST_EQ(parallel_totals.failed, serial_totals.failed);
+    BOOST_TEST_EQ(parallel_totals.invalid, serial_totals.invalid);
+    BOOST_TEST_EQ(parallel_totals.skipped, serial_totals.skipped);
+}
+
+int main()
+{
+    std::cerr << std::setprecision(17);
+
+    // The same files as the serial tests, all on one runner so the workers can balance across files
+    test_against_serial({"dectest0/add0.decTest",
+                         "dectest0/subtract0.decTest",
+                         "dectest0/multiply0.decTest",
+                         "dectest0/divide0.decTest",
+                         "dectest0/compare0.decTest",
+                         "dectest/compare.decTest",
+                         "dectest/ddCompare.decTest",
+                         "dectest/dqCompare.decTest"}, false, [](boost::decimal::dectest::dectest_runner& runner)
+    {
+        runner.add_two_arg("add", [](const auto x, const auto y) { return x + y; })
+              .add_two_arg("subtract", [](const auto x, const auto y) { return x - y; })
+              .add_two_arg("multiply", [](const auto x, const auto y) { return x * y; })
+              .add_two_arg("divide", [](const auto x, const auto y) { return x / y; })
+              .add_comparisons("compare");
+    });
+
+    // Requires rounding-mode changes
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+
+    boost::decimal::fesetround(boost::decimal::rounding_mode::fe_dec_default);
+    std::cerr << std::setprecision(34);
+
+    test_against_serial({"dectest/ddAdd.decTest",
+                         "dectest/dqAdd.decTest",
+                         "dectest/ddSubtract.decTest",
+                         "dectest/dqSubtract.decTest",
+                         "dectest/ddMultiply.decTest",
+                         "dectest/dqMultiply.decTest",
+                         "dectest/ddRemainder.decTest",
+                         "dectest/dqRemainder.decTest"}, true, [](boost::decimal::dectest::dectest_runner& runner)
+    {
+        runner.add_two_arg("add", [](const auto x, const auto y) { return x + y; })
+              .add_two_arg("subtract", [](const auto x, const auto y) { return x - y; })
+              .add_two_arg("multiply", [](const auto x, const auto y) { return x * y; })
+              .add_two_arg("remainder", [](const auto x, const auto y) { return x % y; });
+    });
+
+    #endif // BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+
+    return boost::report_errors();
+}
@@ -0,0 +1,77 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+
+using namespace boost::decimal::dectest;
+
+void test_sample()
+{
+    perf_sample a;
+    a.counts[perf_instructions] = 10U;
+    a.valid[perf_instructions] = true;
+
+    perf_sample b;
+    b.counts[perf_instructions] = 5U;
+    b.counts[perf_cycles] = 7U;
+    b.valid[perf_cycles] = true;
+
+    a += b;
+    BOOST_TEST_EQ(a.counts[perf_instructions], 15U);
+    BOOST_TEST_EQ(a.counts[perf_cycles], 7U);
+    BOOST_TEST(a.valid[perf_instructions]);
+    BOOST_TEST(a.valid[perf_cycles]);
+    BOOST_TEST(!a.valid[perf_branch_misses]);
+}
+
+// Wherever the counters can be opened they count the work between start and stop
+void test_counters()
+{
+    perf_counters counters;
+    if (!counters.available())
+    {
+        return;
+    }
+
+    counters.start();
+
+    volatile std::uint64_t sum {};
+    for (std::uint64_t i {}; i < 100000U; ++i)
+    {
+        sum = sum + i;
+    }
+
+    const auto sample {counters.stop()};
+    if (sample.valid[perf_instructions])
+    {
+        BOOST_TEST_GT(sample.counts[perf_instructions], 100000U);
+    }
+}
+
+// Counting does not change the outcome of a run, with or without counters
+void test_runner()
+{
+    const auto add = [](const auto x, const auto y) { return x + y; };
+    using add_type = decltype(add);
+
+    const auto handler {new two_arg_handler<add_type>(add, 0U)};
+
+    dectest_runner runner;
+    runner.record_perf(true)
+          .add("add", std::unique_ptr<op_handler>(handler));
+    runner.run("dectest0/add0.decTest");
+
+    BOOST_TEST_GT(handler->num_tests_found, 0U);
+}
+
+int main()
+{
+    test_sample();
+    test_counters();
+    test_runner();
+
+    return boost::report_errors();
+}
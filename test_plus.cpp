@@ -5,11 +5,11 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    test_one_arg_harness("dectest0/plus0.decTest", "plus", [](const auto x) { return +x; });
-    test_one_arg_harness("dectest0/inexact0.decTest", "plus", [](const auto x) { return +x; });
+    boost::decimal::dectest::run_registered("plus", boost::decimal::dectest::register_plus<>);
 
     return boost::report_errors();
 }
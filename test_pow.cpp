@@ -5,11 +5,13 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
     std::cerr << std::setprecision(17);
-    test_two_arg_harness("dectest0/power0.decTest", "power", [](const auto x, const auto y) { return pow(x, y); }, 10U);
+
+    boost::decimal::dectest::run_registered("power", boost::decimal::dectest::register_power<>);
 
     return boost::report_errors();
 }
@@ -0,0 +1,46 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_registry.hpp"
+
+#ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+
+// decTest down is toward zero, as in ddqua1511, and the library has no mode for up
+void test_rounding_modes()
+{
+    using namespace boost::decimal;
+
+    BOOST_TEST(set_dectest_rounding(dectest::rounding::down));
+    BOOST_TEST(fegetround() == rounding_mode::fe_dec_toward_zero);
+    BOOST_TEST_EQ(quantize(decimal64_t {"-1.2399"}, decimal64_t {"1.00"}), decimal64_t {"-1.23"});
+
+    BOOST_TEST(set_dectest_rounding(dectest::rounding::floor));
+    BOOST_TEST(fegetround() == rounding_mode::fe_dec_downward);
+    BOOST_TEST_EQ(quantize(decimal64_t {"-1.2399"}, decimal64_t {"1.00"}), decimal64_t {"-1.24"});
+
+    BOOST_TEST(!set_dectest_rounding(dectest::rounding::up));
+
+    fesetround(rounding_mode::fe_dec_default);
+}
+
+#endif
+
+int main()
+{
+    // Requires rounding-mode changes, the registry has no quantize or rescale file without them
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+
+    test_rounding_modes();
+
+    std::cerr << std::setprecision(std::numeric_limits<boost::decimal::decimal128_t>::max_digits10);
+    boost::decimal::dectest::run_registered("quantize", boost::decimal::dectest::register_quantize<>);
+    boost::decimal::dectest::run_registered("rescale", boost::decimal::dectest::register_rescale<>);
+
+    #endif
+
+    return boost::report_errors();
+}
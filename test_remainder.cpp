@@ -5,20 +5,12 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    std::cerr << std::setprecision(17);
-    test_two_arg_harness("dectest0/remainder0.decTest", "remainder", [](const auto x, const auto y) { return x % y; });
-
-    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
-
-    test_two_arg_harness<true>("dectest/ddRemainder.decTest", "remainder", [](const auto x, const auto y) { return x % y; });
-
-    std::cerr << std::setprecision(34);
-    test_two_arg_harness<true>("dectest/dqRemainder.decTest", "remainder", [](const auto x, const auto y) { return x % y; });
-
-    #endif // BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    std::cerr << std::setprecision(std::numeric_limits<boost::decimal::decimal128_t>::max_digits10);
+    boost::decimal::dectest::run_registered("remainder", boost::decimal::dectest::register_remainder<>);
 
     return boost::report_errors();
 }
@@ -0,0 +1,33 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include "dectest_registry.hpp"
+
+// The registry checks scalbn, this is the same scale as a long
+template <typename T>
+void test_scalbln(const std::string& file)
+{
+    std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10);
+
+    boost::decimal::dectest::dectest_runner ln;
+    ln.restrict_to(boost::decimal::dectest::integer_scale)
+      .add_typed<T, 2U>("scaleb", [](const T x, const T y) { return scalbln(x, static_cast<long>(y)); });
+    ln.run(file);
+}
+
+int main()
+{
+    using namespace boost::decimal;
+
+    std::cerr << std::setprecision(std::numeric_limits<decimal128_t>::max_digits10);
+    dectest::run_registered("scaleb", dectest::register_scaleb<>);
+
+    test_scalbln<decimal64_t>("archive/dectest/ddScaleB.decTest");
+    test_scalbln<decimal128_t>("archive/dectest/dqScaleB.decTest");
+
+    return boost::report_errors();
+}
@@ -0,0 +1,125 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include <cstdio>
+
+using namespace boost::decimal::dectest;
+
+void test_parse_shard()
+{
+    shard_spec shard;
+    BOOST_TEST(parse_shard("2/5", shard));
+    BOOST_TEST_EQ(shard.index, 2U);
+    BOOST_TEST_EQ(shard.count, 5U);
+    BOOST_TEST(shard.active());
+    BOOST_TEST_EQ(shard_name(shard), "2/5");
+
+    BOOST_TEST(!parse_shard("5/5", shard));
+    BOOST_TEST(!parse_shard("-1/5", shard));
+    BOOST_TEST(!parse_shard("1/0", shard));
+    BOOST_TEST(!parse_shard("1", shard));
+    BOOST_TEST(!parse_shard("a/b", shard));
+
+    BOOST_TEST(!shard_spec().active());
+}
+
+// The shards of a run see every case of the file exactly once
+void test_partition()
+{
+    const auto add = [](const auto x, const auto y) { return x + y; };
+    using add_type = decltype(add);
+
+    constexpr std::size_t count {3U};
+    std::size_t sharded {};
+    std::size_t smallest {std::numeric_limits<std::size_t>::max()};
+    std::size_t largest {};
+
+    for (std::size_t index {}; index < count; ++index)
+    {
+        const auto handler {new two_arg_handler<add_type>(add, 0U)};
+
+        dectest_runner runner;
+        runner.shard(shard_spec {index, count})
+              .add("add", std::unique_ptr<op_handler>(handler));
+        runner.run("dectest0/add0.decTest");
+
+        sharded += handler->num_tests_found;
+        smallest = std::min(smallest, handler->num_tests_found);
+        largest = std::max(largest, handler->num_tests_found);
+    }
+
+    const auto handler {new two_arg_handler<add_type>(add, 0U)};
+    dectest_runner runner;
+    runner.shard(shard_spec {})
+          .add("add", std::unique_ptr<op_handler>(handler));
+    runner.run("dectest0/add0.decTest");
+
+    BOOST_TEST_EQ(sharded, handler->num_tests_found);
+
+    // The hash spreads the cases evenly
+    BOOST_TEST_GT(smallest * 2U, largest);
+}
+
+void test_results_file()
+{
+    const std::string path {"test_shard_results.txt"};
+    std::remove(path.c_str());
+
+    shard_result r;
+    r.shard = "1/4";
+    r.file = "dectest/ddAdd.decTest";
+    r.op = "add";
+    r.found = 10U;
+    r.failed = 2U;
+    r.invalid = 1U;
+    r.skipped = 3U;
+    r.microseconds = 1234U;
+    r.failed_ids = {"ddadd011", "ddadd012"};
+
+    BOOST_TEST(append_results(path, r.shard, {r}));
+    BOOST_TEST(append_results(path, r.shard, {r}));
+
+    // A shard that got no case is still named by its run
+    BOOST_TEST(append_results(path, "2/4", {}));
+
+    std::vector<shard_result> results;
+    std::vector<std::string> shards;
+    BOOST_TEST(read_results(path, results, shards));
+    BOOST_TEST_EQ(results.size(), 2U);
+    BOOST_TEST_EQ(shards.size(), 2U);
+
+    if (shards.size() == 2U)
+    {
+        BOOST_TEST_EQ(shards[0], "1/4");
+        BOOST_TEST_EQ(shards[1], "2/4");
+    }
+
+    if (!results.empty())
+    {
+        const auto& back {results.back()};
+        BOOST_TEST_EQ(back.shard, "1/4");
+        BOOST_TEST_EQ(back.file, "dectest/ddAdd.decTest");
+        BOOST_TEST_EQ(back.op, "add");
+        BOOST_TEST_EQ(back.found, 10U);
+        BOOST_TEST_EQ(back.failed, 2U);
+        BOOST_TEST_EQ(back.invalid, 1U);
+        BOOST_TEST_EQ(back.skipped, 3U);
+        BOOST_TEST_EQ(back.microseconds, 1234U);
+        BOOST_TEST_EQ(back.failed_ids.size(), 2U);
+    }
+
+    std::remove(path.c_str());
+}
+
+int main()
+{
+    test_parse_shard();
+    test_partition();
+    test_results_file();
+
+    return boost::report_errors();
+}
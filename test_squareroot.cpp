@@ -5,11 +5,13 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
     std::cerr << std::setprecision(17);
-    test_one_arg_harness("dectest0/squareroot0.decTest", "squareroot", [](const auto x) { return boost::decimal::sqrt(x); }, 10000000U);
+
+    boost::decimal::dectest::run_registered("squareroot", boost::decimal::dectest::register_squareroot<>);
 
     return boost::report_errors();
 }
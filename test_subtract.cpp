@@ -5,20 +5,12 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    std::cerr << std::setprecision(17);
-    test_two_arg_harness("dectest0/subtract0.decTest", "subtract", [](const auto x, const auto y) { return x - y; });
-
-    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
-
-    test_two_arg_harness<true>("dectest/ddSubtract.decTest", "subtract", [](const auto x, const auto y) { return x - y; });
-
-    std::cerr << std::setprecision(34);
-    test_two_arg_harness<true>("dectest/dqSubtract.decTest", "subtract", [](const auto x, const auto y) { return x - y; });
-
-    #endif
+    std::cerr << std::setprecision(std::numeric_limits<boost::decimal::decimal128_t>::max_digits10);
+    boost::decimal::dectest::run_registered("subtract", boost::decimal::dectest::register_subtract<>);
 
     return boost::report_errors();
 }
@@ -1,15 +1,17 @@
-// Copyright 2025 Matt Borland
+// Copyright 2026 Matt Borland
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
 
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include "test_harness.hpp"
+#include "dectest_registry.hpp"
 
 int main()
 {
-    std::cerr << std::setprecision(17);
-    test_one_arg_harness("dectest0/tointegral0.decTest", "tointegral", [](const auto x) { return static_cast<std::int64_t>(x); });
+    std::cerr << std::setprecision(std::numeric_limits<boost::decimal::decimal128_t>::max_digits10);
+    boost::decimal::dectest::run_registered("tointegral", boost::decimal::dectest::register_tointegral<>);
+    boost::decimal::dectest::run_registered("tointegralx", boost::decimal::dectest::register_tointegralx<>);
 
     return boost::report_errors();
 }
@@ -0,0 +1,231 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include <new>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Count every allocation made through operator new in this program
+static std::size_t allocation_count {};
+
+void* operator new(std::size_t size)
+{
+    ++allocation_count;
+
+    if (void* ptr = std::malloc(size == 0U ? 1U : size))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+using namespace boost::decimal::dectest;
+
+void test_records()
+{
+    const char* text =
+        "------------------------------------------\r\n"
+        "-- ddAdd.decTest -- decDouble addition --\r\n"
+        "version: 2.62\r\n"
+        "\r\n"
+        "precision:   16 -- decDouble\r\n"
+        "rounding:    half_even\r\n"
+        "This line is free text\r\n"
+        "ddadd001 add 1 1 -> 2\r\n"
+        "ddadd002 add '1 000' \"2''\" -> 'NaN' Conversion_syntax\r\n"
+        "ddadd003 add  '--1'  -0  ->  -1   Inexact Rounded -- this is a comment Clamped\r\n"
+        "ddadd004 add 10  # -> NaN Invalid_operation\r\n"
+        "ddfma001 fma 1 2 3 -> 5\r\n"
+        "ddadd005 add 1 ->\r\n"
+        "ddadd006 add 1 2 -> 3";
+
+    tokenizer tok {text};
+    record r;
+
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST(r.kind == record_kind::comment);
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST(r.kind == record_kind::comment);
+
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST(r.kind == record_kind::directive);
+    BOOST_TEST_EQ(r.keyword, "version");
+    BOOST_TEST_EQ(r.value, "2.62");
+
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST(r.kind == record_kind::comment);
+
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST(r.kind == record_kind::directive);
+    BOOST_TEST_EQ(r.value, "16");
+    BOOST_TEST_EQ(tok.ctx().precision, 16);
+
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST(r.kind == record_kind::directive);
+    BOOST_TEST(tok.ctx().round == rounding::half_even);
+
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST(r.kind == record_kind::comment);
+
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST(r.kind == record_kind::test_case);
+    BOOST_TEST_EQ(r.tc.id, "ddadd001");
+    BOOST_TEST_EQ(r.tc.op, "add");
+    BOOST_TEST_EQ(r.tc.operand_count, 2U);
+    BOOST_TEST_EQ(r.tc.result, "2");
+    BOOST_TEST_EQ(r.tc.line, 8U);
+    BOOST_TEST(r.tc.ctx.round == rounding::half_even);
+
+    // Quoted operands keep their spaces and doubled quotes
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST_EQ(r.tc.operands[0], "1 000");
+    BOOST_TEST_EQ(r.tc.operands[1], "2''");
+    BOOST_TEST_EQ(r.tc.result, "NaN");
+    BOOST_TEST_EQ(r.tc.conditions, condition::conversion_syntax);
+
+    // Conditions stop at a trailing comment, a quoted "--" is an operand
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST_EQ(r.tc.operands[0], "--1");
+    BOOST_TEST_EQ(r.tc.operands[1], "-0");
+    BOOST_TEST_EQ(r.tc.conditions, condition::inexact | condition::rounded);
+    BOOST_TEST_EQ(r.tc.flags, 0U);
+
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST_EQ(r.tc.flags, case_flags::hash_marker);
+    BOOST_TEST_EQ(r.tc.operands[1], "#");
+
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST_EQ(r.tc.op, "fma");
+    BOOST_TEST_EQ(r.tc.operand_count, 3U);
+    BOOST_TEST_EQ(r.tc.operands[2], "3");
+
+    BOOST_TEST(tok.next(r));
+    BOOST_TEST_EQ(r.tc.id, "ddadd005");
+    BOOST_TEST_EQ(r.tc.flags, case_flags::malformed);
+
+    // The last line has no terminator
+    BOOST_TEST(tok.next_test_case(r));
+    BOOST_TEST_EQ(r.tc.id, "ddadd006");
+    BOOST_TEST_EQ(r.tc.result, "3");
+
+    BOOST_TEST(!tok.next(r));
+}
+
+void test_allocations()
+{
+    const char* files[] {
+        "dectest/ddAdd.decTest",
+        "dectest/dqAdd.decTest",
+        "dectest/ddDivide.decTest",
+        "dectest/dqMultiply.decTest",
+        "dectest/base.decTest",
+        "dectest/comparetotal.decTest",
+        "dectest0/inexact0.decTest",
+        "dectest0/squareroot0.decTest"
+    };
+
+    std::vector<std::string> texts;
+    for (const auto file : files)
+    {
+        const auto full_path {where_file(file)};
+        std::ifstream in(full_path.c_str(), std::ios::binary);
+        if (!BOOST_TEST(in.is_open()))
+        {
+            std::cerr << "Failed to open file: " << file << std::endl;
+            continue;
+        }
+
+        texts.emplace_back(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    // Everything below runs on the loaded text only
+    const auto allocations_before {allocation_count};
+
+    std::size_t num_cases {};
+    std::size_t num_adds {};
+    for (const auto& text : texts)
+    {
+        tokenizer tok {text};
+        record r;
+        while (tok.next_test_case(r))
+        {
+            ++num_cases;
+
+            // Evaluate the decDouble additions the same way the harness does
+            if (r.tc.op == "add" && r.tc.ctx.precision == 16 && r.tc.flags == 0U && r.tc.operand_count == 2U)
+            {
+                try
+                {
+                    const auto lhs {make_decimal<boost::decimal::decimal64_t>(r.tc.operands[0])};
+                    const auto rhs {make_decimal<boost::decimal::decimal64_t>(r.tc.operands[1])};
+                    const auto res {lhs + rhs};
+                    static_cast<void>(res);
+                    ++num_adds;
+                }
+                catch (...)
+                {
+                    // Invalid construction is supposed to throw
+                }
+            }
+        }
+    }
+
+    const auto allocations {allocation_count - allocations_before};
+
+    std::cerr << "Tokenized " << num_cases << " test cases and evaluated " << num_adds << " additions with "
+              << allocations << " allocations (" << static_cast<double>(allocations) / static_cast<double>(num_cases)
+              << " per test case)" << std::endl;
+
+    BOOST_TEST_GT(num_cases, 5000U);
+    BOOST_TEST_GT(num_adds, 0U);
+    BOOST_TEST_EQ(allocations, 0U);
+}
+
+void test_encoded()
+{
+    encoded_operand value {};
+
+    BOOST_TEST(parse_encoded("#A2300000000003D0", value));
+    BOOST_TEST_EQ(value.digits, 16U);
+    BOOST_TEST_EQ(value.high, 0U);
+    BOOST_TEST_EQ(value.low, UINT64_C(0xA2300000000003D0));
+
+    BOOST_TEST(parse_encoded("#a26ff3fc", value));
+    BOOST_TEST_EQ(value.digits, 8U);
+    BOOST_TEST_EQ(value.low, UINT64_C(0xa26ff3fc));
+
+    BOOST_TEST(parse_encoded("#77ffcff3fcff3fcff3fcff3fcff3fcff", value));
+    BOOST_TEST_EQ(value.digits, 32U);
+    BOOST_TEST_EQ(value.high, UINT64_C(0x77ffcff3fcff3fcf));
+    BOOST_TEST_EQ(value.low, UINT64_C(0xf3fcff3fcff3fcff));
+
+    BOOST_TEST(!parse_encoded("#", value));
+    BOOST_TEST(!parse_encoded("A2300000000003D0", value));
+    BOOST_TEST(!parse_encoded("#A2300000000003D", value));
+    BOOST_TEST(!parse_encoded("#A2300000000003DG", value));
+}
+
+int main()
+{
+    test_records();
+    test_encoded();
+    test_allocations();
+
+    return boost::report_errors();
+}
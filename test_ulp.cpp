@@ -0,0 +1,112 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "test_harness.hpp"
+#include <sstream>
+
+using namespace boost::decimal;
+
+constexpr auto max_distance {std::numeric_limits<std::size_t>::max()};
+
+template <typename T>
+T value(const char* str)
+{
+    return dectest::make_decimal<T>(dectest::string_view(str));
+}
+
+void test_decimal32()
+{
+    using T = decimal32_t;
+
+    BOOST_TEST_EQ(ulp_distance(value<T>("1"), value<T>("1")), 0U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("1"), value<T>("1.000000")), 0U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("1"), value<T>("1.000001")), 1U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("1.000001"), value<T>("1")), 1U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("-2"), value<T>("-2.000003")), 3U);
+
+    // Across a decade the spacing changes
+    BOOST_TEST_EQ(ulp_distance(value<T>("9.999999"), value<T>("10")), 1U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("9.999999"), value<T>("10.00001")), 2U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("1"), value<T>("10")), 9000000U);
+
+    // Subnormals and zeros
+    const auto min {std::numeric_limits<T>::min()};
+    const auto denorm_min {std::numeric_limits<T>::denorm_min()};
+    BOOST_TEST_EQ(ulp_distance(min, value<T>("9.99999E-96")), 1U);
+    BOOST_TEST_EQ(ulp_distance(min, denorm_min), 999999U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("0"), denorm_min), 1U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("0"), value<T>("-0")), 0U);
+    BOOST_TEST_EQ(ulp_distance(-denorm_min, denorm_min), 2U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("-1"), value<T>("1")), 2U * ulp_distance(value<T>("0"), value<T>("1")));
+
+    // Specials
+    const auto inf {std::numeric_limits<T>::infinity()};
+    BOOST_TEST_EQ(ulp_distance(inf, inf), 0U);
+    BOOST_TEST_EQ(ulp_distance(-inf, inf), max_distance);
+    BOOST_TEST_EQ(ulp_distance(std::numeric_limits<T>::max(), inf), max_distance);
+    BOOST_TEST_EQ(ulp_distance(std::numeric_limits<T>::quiet_NaN(), value<T>("1")), max_distance);
+    BOOST_TEST_EQ(ulp_distance(value<T>("1"), 1.0), max_distance);
+}
+
+void test_decimal64()
+{
+    using T = decimal64_t;
+
+    BOOST_TEST_EQ(ulp_distance(value<T>("1"), value<T>("1.000000000000001")), 1U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("-9.999999999999999E+384"), value<T>("-9.999999999999998E+384")), 1U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("1"), value<T>("10")), 9000000000000000U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("1E-398"), value<T>("-1E-398")), 2U);
+}
+
+void test_decimal128()
+{
+    using T = decimal128_t;
+
+    BOOST_TEST_EQ(ulp_distance(value<T>("1"), value<T>("1.000000000000000000000000000000001")), 1U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("1E+6144"), value<T>("9.999999999999999999999999999999999E+6143")), 1U);
+    BOOST_TEST_EQ(ulp_distance(value<T>("1E-6176"), value<T>("3E-6176")), 2U);
+
+    // Wider than std::size_t
+    BOOST_TEST_EQ(ulp_distance(std::numeric_limits<T>::max(), -std::numeric_limits<T>::max()), max_distance);
+    BOOST_TEST_EQ(ulp_distance(value<T>("1"), value<T>("1E+20")), max_distance);
+}
+
+void test_histogram()
+{
+    dectest::ulp_histogram histogram;
+    for (const std::size_t distance : {0U, 0U, 1U, 2U, 3U, 4U, 1000U})
+    {
+        histogram.record(distance);
+    }
+    histogram.record(max_distance);
+
+    BOOST_TEST_EQ(histogram.size(), 8U);
+    BOOST_TEST_EQ(histogram.max(), max_distance);
+    BOOST_TEST_EQ(histogram.count(0U), 2U);
+    BOOST_TEST_EQ(histogram.count(1U), 1U);
+    BOOST_TEST_EQ(histogram.count(2U), 2U);
+    BOOST_TEST_EQ(histogram.count(3U), 1U);
+    BOOST_TEST_EQ(histogram.count(10U), 1U);
+    BOOST_TEST_EQ(histogram.count(dectest::ulp_histogram::bucket_count - 1U), 1U);
+
+    std::ostringstream os;
+    histogram.print("squareroot", "mem/squareroot.decTest", os);
+    BOOST_TEST(os.str().find("ULP error of squareroot in mem/squareroot.decTest, 8 cases") != std::string::npos);
+
+    histogram.reset();
+    BOOST_TEST_EQ(histogram.size(), 0U);
+    BOOST_TEST_EQ(histogram.max(), 0U);
+}
+
+int main()
+{
+    test_decimal32();
+    test_decimal64();
+    test_decimal128();
+    test_histogram();
+
+    return boost::report_errors();
+}